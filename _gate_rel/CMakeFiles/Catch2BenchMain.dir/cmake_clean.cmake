@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Catch2BenchMain.dir/bench/catch2_bench_main.cpp.o"
+  "CMakeFiles/Catch2BenchMain.dir/bench/catch2_bench_main.cpp.o.d"
+  "libCatch2BenchMain.a"
+  "libCatch2BenchMain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Catch2BenchMain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Catch2Main.dir/test/catch2_main.cpp.o"
+  "CMakeFiles/Catch2Main.dir/test/catch2_main.cpp.o.d"
+  "libCatch2Main.a"
+  "libCatch2Main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Catch2Main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
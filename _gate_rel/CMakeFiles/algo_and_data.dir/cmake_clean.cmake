@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libalgo_and_data.a"
+  "libalgo_and_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/algo_and_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libalgo_and_data.a"
+)
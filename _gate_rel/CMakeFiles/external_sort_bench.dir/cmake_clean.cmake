@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/external_sort_bench.dir/bench/external_sort_bench.cpp.o"
+  "CMakeFiles/external_sort_bench.dir/bench/external_sort_bench.cpp.o.d"
+  "external_sort_bench"
+  "external_sort_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_sort_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
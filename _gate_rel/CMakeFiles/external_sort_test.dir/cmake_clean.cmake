@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/external_sort_test.dir/test/external_sort_test.cpp.o"
+  "CMakeFiles/external_sort_test.dir/test/external_sort_test.cpp.o.d"
+  "external_sort_test"
+  "external_sort_test.pdb"
+  "external_sort_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_bench.dir/bench/map_bench.cpp.o"
+  "CMakeFiles/map_bench.dir/bench/map_bench.cpp.o.d"
+  "map_bench"
+  "map_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_test.dir/test/map_test.cpp.o"
+  "CMakeFiles/map_test.dir/test/map_test.cpp.o.d"
+  "map_test"
+  "map_test.pdb"
+  "map_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_bench.dir/bench/merge_bench.cpp.o"
+  "CMakeFiles/merge_bench.dir/bench/merge_bench.cpp.o.d"
+  "merge_bench"
+  "merge_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_test.dir/test/merge_test.cpp.o"
+  "CMakeFiles/merge_test.dir/test/merge_test.cpp.o.d"
+  "merge_test"
+  "merge_test.pdb"
+  "merge_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_queue_bench.dir/bench/multi_queue_bench.cpp.o"
+  "CMakeFiles/multi_queue_bench.dir/bench/multi_queue_bench.cpp.o.d"
+  "multi_queue_bench"
+  "multi_queue_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multi_queue_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
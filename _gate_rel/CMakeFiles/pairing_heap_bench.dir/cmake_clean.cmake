@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pairing_heap_bench.dir/bench/pairing_heap_bench.cpp.o"
+  "CMakeFiles/pairing_heap_bench.dir/bench/pairing_heap_bench.cpp.o.d"
+  "pairing_heap_bench"
+  "pairing_heap_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pairing_heap_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pairing_heap_test.dir/test/pairing_heap_test.cpp.o"
+  "CMakeFiles/pairing_heap_test.dir/test/pairing_heap_test.cpp.o.d"
+  "pairing_heap_test"
+  "pairing_heap_test.pdb"
+  "pairing_heap_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pairing_heap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
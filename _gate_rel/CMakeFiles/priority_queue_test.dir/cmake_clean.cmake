@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/priority_queue_test.dir/test/priority_queue_test.cpp.o"
+  "CMakeFiles/priority_queue_test.dir/test/priority_queue_test.cpp.o.d"
+  "priority_queue_test"
+  "priority_queue_test.pdb"
+  "priority_queue_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/priority_queue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rb_map_bench.dir/bench/rb_map_bench.cpp.o"
+  "CMakeFiles/rb_map_bench.dir/bench/rb_map_bench.cpp.o.d"
+  "rb_map_bench"
+  "rb_map_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rb_map_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rb_map_test.dir/test/rb_map_test.cpp.o"
+  "CMakeFiles/rb_map_test.dir/test/rb_map_test.cpp.o.d"
+  "rb_map_test"
+  "rb_map_test.pdb"
+  "rb_map_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rb_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
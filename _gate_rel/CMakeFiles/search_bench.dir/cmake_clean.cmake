@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/search_bench.dir/bench/search_bench.cpp.o"
+  "CMakeFiles/search_bench.dir/bench/search_bench.cpp.o.d"
+  "search_bench"
+  "search_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/search_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
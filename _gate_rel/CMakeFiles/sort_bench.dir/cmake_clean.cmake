@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort_bench.dir/bench/sort_bench.cpp.o"
+  "CMakeFiles/sort_bench.dir/bench/sort_bench.cpp.o.d"
+  "sort_bench"
+  "sort_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort_test.dir/test/sort_test.cpp.o"
+  "CMakeFiles/sort_test.dir/test/sort_test.cpp.o.d"
+  "sort_test"
+  "sort_test.pdb"
+  "sort_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/top_k_bench.dir/bench/top_k_bench.cpp.o"
+  "CMakeFiles/top_k_bench.dir/bench/top_k_bench.cpp.o.d"
+  "top_k_bench"
+  "top_k_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/top_k_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
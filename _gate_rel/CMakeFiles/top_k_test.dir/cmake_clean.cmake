@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/top_k_test.dir/test/top_k_test.cpp.o"
+  "CMakeFiles/top_k_test.dir/test/top_k_test.cpp.o.d"
+  "top_k_test"
+  "top_k_test.pdb"
+  "top_k_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/top_k_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_rel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_rel/map_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/priority_queue_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/rb_map_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/sort_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/external_sort_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/merge_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/search_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/multi_queue_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/pairing_heap_test_include-b12d07c.cmake")
+include("/root/repo/_gate_rel/top_k_test_include-b12d07c.cmake")
@@ -0,0 +1,5 @@
+add_test( [==[external_sort sorts files]==] /root/repo/_gate_rel/external_sort_test [==[external_sort sorts files]==]  )
+set_tests_properties( [==[external_sort sorts files]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[external_sort rejects bad input]==] /root/repo/_gate_rel/external_sort_test [==[external_sort rejects bad input]==]  )
+set_tests_properties( [==[external_sort rejects bad input]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( external_sort_test_TESTS [==[external_sort sorts files]==] [==[external_sort rejects bad input]==])
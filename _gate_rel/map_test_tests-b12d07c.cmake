@@ -0,0 +1,29 @@
+add_test( [==[map can construct as <int, int> pair]==] /root/repo/_gate_rel/map_test [==[map can construct as <int\, int> pair]==]  )
+set_tests_properties( [==[map can construct as <int, int> pair]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map can construct as <std::string, int> pair]==] /root/repo/_gate_rel/map_test [==[map can construct as <std::string\, int> pair]==]  )
+set_tests_properties( [==[map can construct as <std::string, int> pair]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map cannot construct as <std::vector<int>, int> pair]==] /root/repo/_gate_rel/map_test [==[map cannot construct as <std::vector<int>\, int> pair]==]  )
+set_tests_properties( [==[map cannot construct as <std::vector<int>, int> pair]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::at returns the node]==] /root/repo/_gate_rel/map_test [==[map::at returns the node]==]  )
+set_tests_properties( [==[map::at returns the node]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::at throws on non-existent key]==] /root/repo/_gate_rel/map_test [==[map::at throws on non-existent key]==]  )
+set_tests_properties( [==[map::at throws on non-existent key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map can insert]==] /root/repo/_gate_rel/map_test [==[map can insert]==]  )
+set_tests_properties( [==[map can insert]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::min returns the minimum]==] /root/repo/_gate_rel/map_test [==[map::min returns the minimum]==]  )
+set_tests_properties( [==[map::min returns the minimum]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::lower_bound returns the floor of key]==] /root/repo/_gate_rel/map_test [==[map::lower_bound returns the floor of key]==]  )
+set_tests_properties( [==[map::lower_bound returns the floor of key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::upper_bound returns the ceiling of key]==] /root/repo/_gate_rel/map_test [==[map::upper_bound returns the ceiling of key]==]  )
+set_tests_properties( [==[map::upper_bound returns the ceiling of key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::erase removes the node with the matching key]==] /root/repo/_gate_rel/map_test [==[map::erase removes the node with the matching key]==]  )
+set_tests_properties( [==[map::erase removes the node with the matching key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map iterators is in non-increasing order]==] /root/repo/_gate_rel/map_test [==[map iterators is in non-increasing order]==]  )
+set_tests_properties( [==[map iterators is in non-increasing order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map begin == end when emtpy]==] /root/repo/_gate_rel/map_test [==[map begin == end when emtpy]==]  )
+set_tests_properties( [==[map begin == end when emtpy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::find_batch finds what at finds]==] /root/repo/_gate_rel/map_test [==[map::find_batch finds what at finds]==]  )
+set_tests_properties( [==[map::find_batch finds what at finds]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[map::find_batch on an empty map]==] /root/repo/_gate_rel/map_test [==[map::find_batch on an empty map]==]  )
+set_tests_properties( [==[map::find_batch on an empty map]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( map_test_TESTS [==[map can construct as <int, int> pair]==] [==[map can construct as <std::string, int> pair]==] [==[map cannot construct as <std::vector<int>, int> pair]==] [==[map::at returns the node]==] [==[map::at throws on non-existent key]==] [==[map can insert]==] [==[map::min returns the minimum]==] [==[map::lower_bound returns the floor of key]==] [==[map::upper_bound returns the ceiling of key]==] [==[map::erase removes the node with the matching key]==] [==[map iterators is in non-increasing order]==] [==[map begin == end when emtpy]==] [==[map::find_batch finds what at finds]==] [==[map::find_batch on an empty map]==])
@@ -0,0 +1,11 @@
+add_test( [==[k_way_merge merges sorted ranges]==] /root/repo/_gate_rel/merge_test [==[k_way_merge merges sorted ranges]==]  )
+set_tests_properties( [==[k_way_merge merges sorted ranges]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[k_way_merge is stable across sources]==] /root/repo/_gate_rel/merge_test [==[k_way_merge is stable across sources]==]  )
+set_tests_properties( [==[k_way_merge is stable across sources]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[k_way_merge pulls from generators]==] /root/repo/_gate_rel/merge_test [==[k_way_merge pulls from generators]==]  )
+set_tests_properties( [==[k_way_merge pulls from generators]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[loser trees nest]==] /root/repo/_gate_rel/merge_test [==[loser trees nest]==]  )
+set_tests_properties( [==[loser trees nest]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[generator rethrows what escapes the coroutine]==] /root/repo/_gate_rel/merge_test [==[generator rethrows what escapes the coroutine]==]  )
+set_tests_properties( [==[generator rethrows what escapes the coroutine]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( merge_test_TESTS [==[k_way_merge merges sorted ranges]==] [==[k_way_merge is stable across sources]==] [==[k_way_merge pulls from generators]==] [==[loser trees nest]==] [==[generator rethrows what escapes the coroutine]==])
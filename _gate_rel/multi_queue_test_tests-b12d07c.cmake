@@ -0,0 +1,7 @@
+add_test( [==[multi_queue with a single shard is an exact priority queue]==] /root/repo/_gate_rel/multi_queue_test [==[multi_queue with a single shard is an exact priority queue]==]  )
+set_tests_properties( [==[multi_queue with a single shard is an exact priority queue]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[multi_queue pops every element once and close to the top]==] /root/repo/_gate_rel/multi_queue_test [==[multi_queue pops every element once and close to the top]==]  )
+set_tests_properties( [==[multi_queue pops every element once and close to the top]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[multi_queue loses and duplicates nothing under concurrent pushes and pops]==] /root/repo/_gate_rel/multi_queue_test [==[multi_queue loses and duplicates nothing under concurrent pushes and pops]==]  )
+set_tests_properties( [==[multi_queue loses and duplicates nothing under concurrent pushes and pops]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( multi_queue_test_TESTS [==[multi_queue with a single shard is an exact priority queue]==] [==[multi_queue pops every element once and close to the top]==] [==[multi_queue loses and duplicates nothing under concurrent pushes and pops]==])
@@ -0,0 +1,7 @@
+add_test( [==[pairing_heap matches a multiset under inserts, pops and decrease_key]==] /root/repo/_gate_rel/pairing_heap_test [==[pairing_heap matches a multiset under inserts\, pops and decrease_key]==]  )
+set_tests_properties( [==[pairing_heap matches a multiset under inserts, pops and decrease_key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[pairing_heap melds in place and keeps handles]==] /root/repo/_gate_rel/pairing_heap_test [==[pairing_heap melds in place and keeps handles]==]  )
+set_tests_properties( [==[pairing_heap melds in place and keeps handles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[pairing_heap melds many heaps and frees what is left]==] /root/repo/_gate_rel/pairing_heap_test [==[pairing_heap melds many heaps and frees what is left]==]  )
+set_tests_properties( [==[pairing_heap melds many heaps and frees what is left]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( pairing_heap_test_TESTS [==[pairing_heap matches a multiset under inserts, pops and decrease_key]==] [==[pairing_heap melds in place and keeps handles]==] [==[pairing_heap melds many heaps and frees what is left]==])
@@ -0,0 +1,27 @@
+add_test( [==[priority queue can construct]==] /root/repo/_gate_rel/priority_queue_test [==[priority queue can construct]==]  )
+set_tests_properties( [==[priority queue can construct]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[priority queue pops in order with any arity]==] /root/repo/_gate_rel/priority_queue_test [==[priority queue pops in order with any arity]==]  )
+set_tests_properties( [==[priority queue pops in order with any arity]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[priority queue builds from a range in bulk]==] /root/repo/_gate_rel/priority_queue_test [==[priority queue builds from a range in bulk]==]  )
+set_tests_properties( [==[priority queue builds from a range in bulk]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[priority queue pops in batches]==] /root/repo/_gate_rel/priority_queue_test [==[priority queue pops in batches]==]  )
+set_tests_properties( [==[priority queue pops in batches]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[child_aligned_allocator aligns the children of the root]==] /root/repo/_gate_rel/priority_queue_test [==[child_aligned_allocator aligns the children of the root]==]  )
+set_tests_properties( [==[child_aligned_allocator aligns the children of the root]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[indexed_priority_queue matches a map of handles to keys]==] /root/repo/_gate_rel/priority_queue_test [==[indexed_priority_queue matches a map of handles to keys]==]  )
+set_tests_properties( [==[indexed_priority_queue matches a map of handles to keys]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[indexed_priority_queue runs Dijkstra]==] /root/repo/_gate_rel/priority_queue_test [==[indexed_priority_queue runs Dijkstra]==]  )
+set_tests_properties( [==[indexed_priority_queue runs Dijkstra]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix_heap pops like a sorted sequence]==] /root/repo/_gate_rel/priority_queue_test [==[radix_heap pops like a sorted sequence]==]  )
+set_tests_properties( [==[radix_heap pops like a sorted sequence]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix_heap takes the key from the element]==] /root/repo/_gate_rel/priority_queue_test [==[radix_heap takes the key from the element]==]  )
+set_tests_properties( [==[radix_heap takes the key from the element]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix_heap rejects keys below the last pop]==] /root/repo/_gate_rel/priority_queue_test [==[radix_heap rejects keys below the last pop]==]  )
+set_tests_properties( [==[radix_heap rejects keys below the last pop]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix_heap top does not raise the floor for inserts]==] /root/repo/_gate_rel/priority_queue_test [==[radix_heap top does not raise the floor for inserts]==]  )
+set_tests_properties( [==[radix_heap top does not raise the floor for inserts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[min_max_heap pops both ends like a multiset]==] /root/repo/_gate_rel/priority_queue_test [==[min_max_heap pops both ends like a multiset]==]  )
+set_tests_properties( [==[min_max_heap pops both ends like a multiset]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[min_max_heap builds from a range in bulk]==] /root/repo/_gate_rel/priority_queue_test [==[min_max_heap builds from a range in bulk]==]  )
+set_tests_properties( [==[min_max_heap builds from a range in bulk]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( priority_queue_test_TESTS [==[priority queue can construct]==] [==[priority queue pops in order with any arity]==] [==[priority queue builds from a range in bulk]==] [==[priority queue pops in batches]==] [==[child_aligned_allocator aligns the children of the root]==] [==[indexed_priority_queue matches a map of handles to keys]==] [==[indexed_priority_queue runs Dijkstra]==] [==[radix_heap pops like a sorted sequence]==] [==[radix_heap takes the key from the element]==] [==[radix_heap rejects keys below the last pop]==] [==[radix_heap top does not raise the floor for inserts]==] [==[min_max_heap pops both ends like a multiset]==] [==[min_max_heap builds from a range in bulk]==])
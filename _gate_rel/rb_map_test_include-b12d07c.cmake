@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_rel/rb_map_test_tests-b12d07c.cmake")
+  include("/root/repo/_gate_rel/rb_map_test_tests-b12d07c.cmake")
+else()
+  add_test(rb_map_test_NOT_BUILT-b12d07c rb_map_test_NOT_BUILT-b12d07c)
+endif()
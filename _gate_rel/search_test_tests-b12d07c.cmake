@@ -0,0 +1,19 @@
+add_test( [==[lower_bound and upper_bound agree with std]==] /root/repo/_gate_rel/search_test [==[lower_bound and upper_bound agree with std]==]  )
+set_tests_properties( [==[lower_bound and upper_bound agree with std]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[lower_bound with a custom order]==] /root/repo/_gate_rel/search_test [==[lower_bound with a custom order]==]  )
+set_tests_properties( [==[lower_bound with a custom order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[binary_search finds present values only]==] /root/repo/_gate_rel/search_test [==[binary_search finds present values only]==]  )
+set_tests_properties( [==[binary_search finds present values only]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[binary_search_batch finds what binary_search finds]==] /root/repo/_gate_rel/search_test [==[binary_search_batch finds what binary_search finds]==]  )
+set_tests_properties( [==[binary_search_batch finds what binary_search finds]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[exponential_lower_bound agrees with std from every hint]==] /root/repo/_gate_rel/search_test [==[exponential_lower_bound agrees with std from every hint]==]  )
+set_tests_properties( [==[exponential_lower_bound agrees with std from every hint]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[exponential_search follows a finger through sorted lookups]==] /root/repo/_gate_rel/search_test [==[exponential_search follows a finger through sorted lookups]==]  )
+set_tests_properties( [==[exponential_search follows a finger through sorted lookups]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[interpolation_lower_bound agrees with std]==] /root/repo/_gate_rel/search_test [==[interpolation_lower_bound agrees with std]==]  )
+set_tests_properties( [==[interpolation_lower_bound agrees with std]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[eytzinger_array searches like a sorted array]==] /root/repo/_gate_rel/search_test [==[eytzinger_array searches like a sorted array]==]  )
+set_tests_properties( [==[eytzinger_array searches like a sorted array]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[static_search_tree searches like a sorted array]==] /root/repo/_gate_rel/search_test [==[static_search_tree searches like a sorted array]==]  )
+set_tests_properties( [==[static_search_tree searches like a sorted array]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( search_test_TESTS [==[lower_bound and upper_bound agree with std]==] [==[lower_bound with a custom order]==] [==[binary_search finds present values only]==] [==[binary_search_batch finds what binary_search finds]==] [==[exponential_lower_bound agrees with std from every hint]==] [==[exponential_search follows a finger through sorted lookups]==] [==[interpolation_lower_bound agrees with std]==] [==[eytzinger_array searches like a sorted array]==] [==[static_search_tree searches like a sorted array]==])
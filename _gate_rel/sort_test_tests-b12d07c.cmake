@@ -0,0 +1,59 @@
+add_test( [==[quick_sort sorts]==] /root/repo/_gate_rel/sort_test [==[quick_sort sorts]==]  )
+set_tests_properties( [==[quick_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[partition puts the pivot in its final position]==] /root/repo/_gate_rel/sort_test [==[partition puts the pivot in its final position]==]  )
+set_tests_properties( [==[partition puts the pivot in its final position]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[three_way_partition groups the elements equal to the pivot]==] /root/repo/_gate_rel/sort_test [==[three_way_partition groups the elements equal to the pivot]==]  )
+set_tests_properties( [==[three_way_partition groups the elements equal to the pivot]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[quick_sort sorts bidirectional ranges]==] /root/repo/_gate_rel/sort_test [==[quick_sort sorts bidirectional ranges]==]  )
+set_tests_properties( [==[quick_sort sorts bidirectional ranges]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[insertion_sort sorts]==] /root/repo/_gate_rel/sort_test [==[insertion_sort sorts]==]  )
+set_tests_properties( [==[insertion_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[introsort sorts]==] /root/repo/_gate_rel/sort_test [==[introsort sorts]==]  )
+set_tests_properties( [==[introsort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[introsort stays O(n log n) on a killer input]==] /root/repo/_gate_rel/sort_test [==[introsort stays O(n log n) on a killer input]==]  )
+set_tests_properties( [==[introsort stays O(n log n) on a killer input]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[three-way quick_sort sorts]==] /root/repo/_gate_rel/sort_test [==[three-way quick_sort sorts]==]  )
+set_tests_properties( [==[three-way quick_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[three-way quick_sort is close to linear on few distinct keys]==] /root/repo/_gate_rel/sort_test [==[three-way quick_sort is close to linear on few distinct keys]==]  )
+set_tests_properties( [==[three-way quick_sort is close to linear on few distinct keys]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[heap_sort sorts in place]==] /root/repo/_gate_rel/sort_test [==[heap_sort sorts in place]==]  )
+set_tests_properties( [==[heap_sort sorts in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[heap_sort needs about n log2(n) comparisons]==] /root/repo/_gate_rel/sort_test [==[heap_sort needs about n log2(n) comparisons]==]  )
+set_tests_properties( [==[heap_sort needs about n log2(n) comparisons]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[merge_sort sorts]==] /root/repo/_gate_rel/sort_test [==[merge_sort sorts]==]  )
+set_tests_properties( [==[merge_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[merge_sort is stable]==] /root/repo/_gate_rel/sort_test [==[merge_sort is stable]==]  )
+set_tests_properties( [==[merge_sort is stable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[merge_sort is linear on sorted input]==] /root/repo/_gate_rel/sort_test [==[merge_sort is linear on sorted input]==]  )
+set_tests_properties( [==[merge_sort is linear on sorted input]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[nth_element puts the nth element in place]==] /root/repo/_gate_rel/sort_test [==[nth_element puts the nth element in place]==]  )
+set_tests_properties( [==[nth_element puts the nth element in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[nth_element stays linear on a killer input]==] /root/repo/_gate_rel/sort_test [==[nth_element stays linear on a killer input]==]  )
+set_tests_properties( [==[nth_element stays linear on a killer input]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[select_k and partial_sort pick the k smallest]==] /root/repo/_gate_rel/sort_test [==[select_k and partial_sort pick the k smallest]==]  )
+set_tests_properties( [==[select_k and partial_sort pick the k smallest]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[SIMD kernels sort and partition like the scalar code - int]==] /root/repo/_gate_rel/sort_test [==[SIMD kernels sort and partition like the scalar code - int]==]  )
+set_tests_properties( [==[SIMD kernels sort and partition like the scalar code - int]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[SIMD kernels sort and partition like the scalar code - long]==] /root/repo/_gate_rel/sort_test [==[SIMD kernels sort and partition like the scalar code - long]==]  )
+set_tests_properties( [==[SIMD kernels sort and partition like the scalar code - long]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[SIMD kernels sort and partition like the scalar code - float]==] /root/repo/_gate_rel/sort_test [==[SIMD kernels sort and partition like the scalar code - float]==]  )
+set_tests_properties( [==[SIMD kernels sort and partition like the scalar code - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[SIMD kernels sort and partition like the scalar code - double]==] /root/repo/_gate_rel/sort_test [==[SIMD kernels sort and partition like the scalar code - double]==]  )
+set_tests_properties( [==[SIMD kernels sort and partition like the scalar code - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[sorts keep NaN keys - float]==] /root/repo/_gate_rel/sort_test [==[sorts keep NaN keys - float]==]  )
+set_tests_properties( [==[sorts keep NaN keys - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[sorts keep NaN keys - double]==] /root/repo/_gate_rel/sort_test [==[sorts keep NaN keys - double]==]  )
+set_tests_properties( [==[sorts keep NaN keys - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[parallel quick_sort sorts]==] /root/repo/_gate_rel/sort_test [==[parallel quick_sort sorts]==]  )
+set_tests_properties( [==[parallel quick_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[sample_sort sorts]==] /root/repo/_gate_rel/sort_test [==[sample_sort sorts]==]  )
+set_tests_properties( [==[sample_sort sorts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix sorts order keys like operator<]==] /root/repo/_gate_rel/sort_test [==[radix sorts order keys like operator<]==]  )
+set_tests_properties( [==[radix sorts order keys like operator<]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[radix sorts sort records through a projection]==] /root/repo/_gate_rel/sort_test [==[radix sorts sort records through a projection]==]  )
+set_tests_properties( [==[radix sorts sort records through a projection]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[string_sort orders like std::string]==] /root/repo/_gate_rel/sort_test [==[string_sort orders like std::string]==]  )
+set_tests_properties( [==[string_sort orders like std::string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[string_sort sorts by a projected key]==] /root/repo/_gate_rel/sort_test [==[string_sort sorts by a projected key]==]  )
+set_tests_properties( [==[string_sort sorts by a projected key]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( sort_test_TESTS [==[quick_sort sorts]==] [==[partition puts the pivot in its final position]==] [==[three_way_partition groups the elements equal to the pivot]==] [==[quick_sort sorts bidirectional ranges]==] [==[insertion_sort sorts]==] [==[introsort sorts]==] [==[introsort stays O(n log n) on a killer input]==] [==[three-way quick_sort sorts]==] [==[three-way quick_sort is close to linear on few distinct keys]==] [==[heap_sort sorts in place]==] [==[heap_sort needs about n log2(n) comparisons]==] [==[merge_sort sorts]==] [==[merge_sort is stable]==] [==[merge_sort is linear on sorted input]==] [==[nth_element puts the nth element in place]==] [==[nth_element stays linear on a killer input]==] [==[select_k and partial_sort pick the k smallest]==] [==[SIMD kernels sort and partition like the scalar code - int]==] [==[SIMD kernels sort and partition like the scalar code - long]==] [==[SIMD kernels sort and partition like the scalar code - float]==] [==[SIMD kernels sort and partition like the scalar code - double]==] [==[sorts keep NaN keys - float]==] [==[sorts keep NaN keys - double]==] [==[parallel quick_sort sorts]==] [==[sample_sort sorts]==] [==[radix sorts order keys like operator<]==] [==[radix sorts sort records through a projection]==] [==[string_sort orders like std::string]==] [==[string_sort sorts by a projected key]==])
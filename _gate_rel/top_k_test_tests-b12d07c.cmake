@@ -0,0 +1,7 @@
+add_test( [==[top_k keeps the greatest of a stream]==] /root/repo/_gate_rel/top_k_test [==[top_k keeps the greatest of a stream]==]  )
+set_tests_properties( [==[top_k keeps the greatest of a stream]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[top_k rejects what does not beat the threshold]==] /root/repo/_gate_rel/top_k_test [==[top_k rejects what does not beat the threshold]==]  )
+set_tests_properties( [==[top_k rejects what does not beat the threshold]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+add_test( [==[top_k merges per-thread accumulators]==] /root/repo/_gate_rel/top_k_test [==[top_k merges per-thread accumulators]==]  )
+set_tests_properties( [==[top_k merges per-thread accumulators]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel)
+set( top_k_test_TESTS [==[top_k keeps the greatest of a stream]==] [==[top_k rejects what does not beat the threshold]==] [==[top_k merges per-thread accumulators]==])
@@ -0,0 +1,43 @@
+#include <external_sort.h>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace {
+struct record {
+    std::uint64_t key;
+    std::uint64_t payload;
+
+    friend auto operator<=>(record const&, record const&) = default;
+};
+}  // namespace
+
+TEST_CASE("external_sort against sequential I/O", "[external_sort]") {
+    // 256 MiB of records sorted with 32 MiB of memory, which makes 8 runs and one merge pass. Compare with copying the file, which is the I/O both passes need
+    // at the very least.
+    std::size_t const record_count = std::size_t{16} << 20;
+    auto const directory = std::filesystem::temp_directory_path() / "algo_external_sort_bench";
+    std::filesystem::create_directories(directory);
+    auto const input = directory / "input";
+    auto const output = directory / "output";
+
+    {
+        std::mt19937_64 rand_engine{42};
+        std::vector<record> records(record_count);
+        for (auto& r : records) {
+            r = {rand_engine(), rand_engine()};
+        }
+        auto file = algo::external_details::open_file(input, "wb");
+        algo::external_details::write_records(file.get(), records.data(), records.size());
+    }
+
+    BENCHMARK("external_sort, 256 MiB with 32 MiB of memory") {
+        algo::external_sort<record>(input, output, {.memory_limit = std::size_t{32} << 20, .temp_directory = directory});
+    };
+    BENCHMARK("copy, 256 MiB") { std::filesystem::copy_file(input, output, std::filesystem::copy_options::overwrite_existing); };
+
+    std::filesystem::remove_all(directory);
+}
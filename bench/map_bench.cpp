@@ -0,0 +1,44 @@
+#include <map.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("map lookups one by one and interleaved in batches", "[map][find_batch]") {
+    // from a tree that fits in L2 to one far beyond the last level cache, every benchmark runs the same 1M random lookups of present keys
+    auto const size = GENERATE(std::size_t{1} << 12, std::size_t{1} << 16, std::size_t{1} << 22);
+    std::vector<int> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937_64 rand_engine{42};
+    std::shuffle(keys.begin(), keys.end(), rand_engine);
+
+    algo::map<int, int> map;
+    for (auto const key : keys) {
+        map.insert({key, key});
+    }
+
+    std::vector<int> lookups(1 << 20);
+    std::generate(lookups.begin(), lookups.end(), [&] { return static_cast<int>(rand_engine() % size); });
+    std::vector<int*> found(lookups.size());
+
+    auto const label = std::to_string(size) + " keys";
+    BENCHMARK("map::at, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += map.at(lookup);
+        }
+        return sum;
+    };
+    BENCHMARK("map::find_batch, " + label) {
+        map.find_batch(lookups, found);
+        std::int64_t sum = 0;
+        for (auto const* value : found) {
+            sum += *value;
+        }
+        return sum;
+    };
+}
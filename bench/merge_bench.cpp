@@ -0,0 +1,47 @@
+#include <merge.h>
+#include <priority_queue.h>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("k_way_merge against a heap of the runs", "[k_way_merge]") {
+    // about 10M ints, split into a few or into hundreds of sorted shards
+    auto const run_count = GENERATE(std::size_t{16}, std::size_t{512});
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::vector<int>> runs(run_count, std::vector<int>(10'240'000 / run_count));
+    for (auto& run : runs) {
+        std::generate(run.begin(), run.end(), [&] { return static_cast<int>(rand_engine()); });
+        std::sort(run.begin(), run.end());
+    }
+    std::vector<std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>> ranges;
+    for (auto const& run : runs) {
+        ranges.emplace_back(run.begin(), run.end());
+    }
+    std::vector<int> output(runs.size() * runs.front().size());
+
+    BENCHMARK("loser tree, " + std::to_string(run_count) + " runs") { return algo::k_way_merge(ranges, output.begin()); };
+
+    BENCHMARK("algo::priority_queue, " + std::to_string(run_count) + " runs") {
+        // a max heap under the reversed order of (element, run) pairs
+        algo::priority_queue<std::pair<int, std::size_t>, std::greater<>> heap;
+        auto positions = ranges;
+        for (std::size_t run = 0; run != positions.size(); ++run) {
+            heap.insert(std::pair{*positions[run].first, run});
+        }
+        auto out = output.begin();
+        while (!heap.empty()) {
+            auto const [value, run] = heap.pop();
+            *out++ = value;
+            if (++positions[run].first != positions[run].second) {
+                heap.insert(std::pair{*positions[run].first, run});
+            }
+        }
+        return out;
+    };
+}
@@ -0,0 +1,150 @@
+#include <multi_queue.h>
+#include <priority_queue.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+/**
+ * The baseline, one heap behind one lock
+ */
+struct locked_heap {
+    std::mutex mutex_;
+    algo::priority_queue<std::int64_t, std::greater<>, 4> heap_;
+
+    void insert(std::int64_t value) {
+        std::lock_guard lock{mutex_};
+        heap_.insert(value);
+    }
+    std::optional<std::int64_t> try_pop() {
+        std::lock_guard lock{mutex_};
+        if (heap_.empty()) {
+            return std::nullopt;
+        }
+        return heap_.pop();
+    }
+};
+
+/**
+ * Every thread runs the hold model, popping an event and scheduling a new one a random delay later, `operations` pops and pushes in total
+ */
+template <typename Queue>
+std::int64_t concurrent_hold(Queue& queue, std::size_t thread_count, std::size_t operations) {
+    std::vector<std::int64_t> sums(thread_count);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937_64 rand_engine{t};
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i != operations / thread_count; ++i) {
+                auto const now = queue.try_pop().value_or(0);
+                sum += now;
+                queue.insert(now + static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 30)));
+            }
+            sums[t] = sum;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return std::accumulate(sums.begin(), sums.end(), std::int64_t{0});
+}
+
+template <typename Queue>
+void fill(Queue& queue, std::size_t size) {
+    std::mt19937_64 rand_engine{42};
+    for (std::size_t i = 0; i != size; ++i) {
+        queue.insert(static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 30)));
+    }
+}
+
+/**
+ * The mean rank error of hold pops: how many queued elements should have come out before the one that did. Keys are drawn from a pool known up front so
+ * that a Fenwick tree over their order can count the smaller ones still queued.
+ */
+double mean_rank_error(algo::multi_queue<std::int64_t, std::greater<>>& queue, std::size_t size, std::size_t operations) {
+    std::mt19937_64 rand_engine{7};
+    std::vector<std::int64_t> keys(size + operations);
+    for (std::size_t i = 0; i != keys.size(); ++i) {
+        // distinct, the low bits carry the index
+        keys[i] = static_cast<std::int64_t>((rand_engine() % (std::uint64_t{1} << 30)) << 24 | i);
+    }
+    auto sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    auto const rank_of = [&](std::int64_t key) { return static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin()); };
+
+    std::vector<std::int64_t> fenwick(sorted.size() + 1);
+    auto const add = [&](std::size_t rank, std::int64_t delta) {
+        for (++rank; rank < fenwick.size(); rank += rank & -rank) {
+            fenwick[rank] += delta;
+        }
+    };
+    auto const smaller = [&](std::size_t rank) {
+        std::int64_t count = 0;
+        for (; rank != 0; rank -= rank & -rank) {
+            count += fenwick[rank];
+        }
+        return count;
+    };
+
+    for (std::size_t i = 0; i != size; ++i) {
+        queue.insert(keys[i]);
+        add(rank_of(keys[i]), 1);
+    }
+    std::int64_t error_sum = 0;
+    for (std::size_t i = 0; i != operations; ++i) {
+        auto const rank = rank_of(*queue.try_pop());
+        error_sum += smaller(rank);
+        add(rank, -1);
+        queue.insert(keys[size + i]);
+        add(rank_of(keys[size + i]), 1);
+    }
+    return static_cast<double>(error_sum) / static_cast<double>(operations);
+}
+}  // namespace
+
+TEST_CASE("concurrent priority queues under a hold workload", "[multi_queue]") {
+    // the numbers only mean something with at least as many cores as threads, std::thread::hardware_concurrency() says how many there are
+    auto const thread_count = GENERATE(std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{8});
+    constexpr std::size_t size = std::size_t{1} << 20;
+    constexpr std::size_t operations = std::size_t{1} << 19;
+
+    locked_heap locked;
+    algo::multi_queue<std::int64_t, std::greater<>> relaxed{thread_count};
+    fill(locked, size);
+    fill(relaxed, size);
+
+    auto const report = [&](std::string const& name, auto& queue) {
+        auto const start = std::chrono::steady_clock::now();
+        concurrent_hold(queue, thread_count, operations);
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << name << ", " << thread_count << " threads: " << static_cast<double>(2 * operations) / elapsed.count() / 1e6 << " Mops/s\n";
+    };
+    report("locked heap", locked);
+    report("multi_queue", relaxed);
+
+    auto const label = std::to_string(thread_count) + " threads";
+    BENCHMARK("locked heap, " + label) { return concurrent_hold(locked, thread_count, operations); };
+    BENCHMARK("multi_queue, " + label) { return concurrent_hold(relaxed, thread_count, operations); };
+}
+
+TEST_CASE("multi_queue rank error by relaxation", "[multi_queue]") {
+    // the rank error depends on the number of shards, not on how many threads share them, so it is measured single threaded
+    for (std::size_t queues_per_thread : {1, 2, 4}) {
+        for (std::size_t thread_count : {1, 4, 16}) {
+            algo::multi_queue<std::int64_t, std::greater<>> queue{thread_count, queues_per_thread};
+            std::cout << queue.shard_count() << " shards: mean rank error " << mean_rank_error(queue, std::size_t{1} << 16, std::size_t{1} << 18) << '\n';
+        }
+    }
+}
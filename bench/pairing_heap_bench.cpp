@@ -0,0 +1,93 @@
+#include <pairing_heap.h>
+#include <priority_queue.h>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+/**
+ * `shard_count` heaps that have each seen a few pops, so that the pairing heaps are shaped like heaps in use rather than a root with a long list of children
+ */
+template <typename Heap>
+std::vector<Heap> make_shards(std::size_t shard_count, std::size_t shard_size) {
+    std::mt19937_64 rand_engine{42};
+    std::vector<Heap> shards(shard_count);
+    for (auto& shard : shards) {
+        for (std::size_t i = 0; i != shard_size; ++i) {
+            shard.insert(static_cast<std::int64_t>(rand_engine() >> 1));
+        }
+        shard.pop();
+    }
+    return shards;
+}
+
+constexpr std::size_t popped_after_merge = 1024;
+}  // namespace
+
+TEST_CASE("merging per-shard queues, then popping the best", "[pairing_heap][priority_queue]") {
+    constexpr std::size_t shard_count = 16;
+    auto const shard_size = GENERATE(std::size_t{1} << 10, std::size_t{1} << 14, std::size_t{1} << 17);
+    using binary_heap = algo::priority_queue<std::int64_t, std::greater<>>;
+    using pairing = algo::pairing_heap<std::int64_t>;
+
+    auto const label = std::to_string(shard_count) + "x" + std::to_string(shard_size);
+    BENCHMARK_ADVANCED("2-ary, pop + insert, " + label)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<binary_heap>> runs;
+        for (int run = 0; run != meter.runs(); ++run) {
+            runs.push_back(make_shards<binary_heap>(shard_count, shard_size));
+        }
+        meter.measure([&](int run) {
+            auto& shards = runs[static_cast<std::size_t>(run)];
+            for (std::size_t i = 1; i != shards.size(); ++i) {
+                while (!shards[i].empty()) {
+                    shards.front().insert(shards[i].pop());
+                }
+            }
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i != popped_after_merge; ++i) {
+                sum += shards.front().pop();
+            }
+            return sum;
+        });
+    };
+    BENCHMARK_ADVANCED("2-ary, pop_n + insert_range, " + label)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<binary_heap>> runs;
+        for (int run = 0; run != meter.runs(); ++run) {
+            runs.push_back(make_shards<binary_heap>(shard_count, shard_size));
+        }
+        std::vector<std::int64_t> buffer(shard_size);
+        meter.measure([&](int run) {
+            auto& shards = runs[static_cast<std::size_t>(run)];
+            for (std::size_t i = 1; i != shards.size(); ++i) {
+                auto const end = shards[i].pop_n(shards[i].size(), buffer.begin());
+                shards.front().insert_range(std::ranges::subrange{buffer.begin(), end});
+            }
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i != popped_after_merge; ++i) {
+                sum += shards.front().pop();
+            }
+            return sum;
+        });
+    };
+    BENCHMARK_ADVANCED("pairing, meld, " + label)(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<pairing>> runs;
+        for (int run = 0; run != meter.runs(); ++run) {
+            runs.push_back(make_shards<pairing>(shard_count, shard_size));
+        }
+        meter.measure([&](int run) {
+            auto& shards = runs[static_cast<std::size_t>(run)];
+            for (std::size_t i = 1; i != shards.size(); ++i) {
+                shards.front().meld(shards[i]);
+            }
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i != popped_after_merge; ++i) {
+                sum += shards.front().pop();
+            }
+            return sum;
+        });
+    };
+}
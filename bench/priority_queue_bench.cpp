@@ -0,0 +1,290 @@
+#include <priority_queue.h>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+/**
+ * The hold model of an event queue: every operation pops the earliest event and schedules a new one a random delay after it, so the size stays put
+ */
+template <typename Heap>
+std::int64_t hold(Heap& heap, std::vector<std::int64_t> const& delays) {
+    std::int64_t sum = 0;
+    for (auto const delay : delays) {
+        auto const now = heap.pop();
+        sum += now;
+        heap.insert(now + delay);
+    }
+    return sum;
+}
+
+struct std_heap {
+    std::priority_queue<std::int64_t, std::vector<std::int64_t>, std::greater<>> heap_;
+
+    std::int64_t pop() {
+        auto const top = heap_.top();
+        heap_.pop();
+        return top;
+    }
+    void insert(std::int64_t value) { heap_.push(value); }
+};
+}  // namespace
+
+TEST_CASE("priority_queue arities under a hold workload", "[priority_queue][arity]") {
+    // 64 KiB of events, which stays in L2, up to 256 MiB, far beyond the last level cache
+    auto const size = GENERATE(std::size_t{1} << 13, std::size_t{1} << 20, std::size_t{1} << 25);
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::int64_t> initial(size);
+    for (auto& time : initial) {
+        time = static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 40));
+    }
+    std::vector<std::int64_t> delays(1 << 21);
+    for (auto& delay : delays) {
+        delay = static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 40));
+    }
+
+    std_heap std_queue;
+    algo::priority_queue<std::int64_t, std::greater<>, 2> binary;
+    algo::priority_queue<std::int64_t, std::greater<>, 4> quaternary;
+    algo::priority_queue<std::int64_t, std::greater<>, 8> octonary;
+    for (auto const time : initial) {
+        std_queue.insert(time);
+        binary.insert(time);
+        quaternary.insert(time);
+        octonary.insert(time);
+    }
+
+    auto const label = std::to_string(size * sizeof(std::int64_t) / 1024) + " KiB";
+    BENCHMARK("std, " + label) { return hold(std_queue, delays); };
+    BENCHMARK("2-ary, " + label) { return hold(binary, delays); };
+    BENCHMARK("4-ary, " + label) { return hold(quaternary, delays); };
+    BENCHMARK("8-ary, " + label) { return hold(octonary, delays); };
+}
+
+TEST_CASE("Dijkstra with lazy deletion and with decrease_key", "[priority_queue][indexed_priority_queue]") {
+    // a random graph of 1M vertices with 8 out edges each
+    constexpr std::size_t vertex_count = 1 << 20;
+    constexpr std::size_t degree = 8;
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges(vertex_count * degree);
+    for (auto& [target, weight] : edges) {
+        target = static_cast<std::uint32_t>(rand_engine() % vertex_count);
+        weight = static_cast<std::uint32_t>(rand_engine() % 1000);
+    }
+    std::vector<std::int64_t> distances(vertex_count);
+    auto const out_edges = [&](std::size_t vertex) {
+        return std::span{edges.data() + vertex * degree, degree};
+    };
+
+    BENCHMARK("priority_queue with stale entries") {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<std::int64_t>::max());
+        algo::priority_queue<std::pair<std::int64_t, std::size_t>, std::greater<>> heap;
+        distances[0] = 0;
+        heap.insert(std::pair{std::int64_t{0}, std::size_t{0}});
+        while (!heap.empty()) {
+            auto const [distance, vertex] = heap.pop();
+            if (distance != distances[vertex]) {
+                continue;
+            }
+            for (auto const& [next, weight] : out_edges(vertex)) {
+                if (distance + weight < distances[next]) {
+                    distances[next] = distance + weight;
+                    heap.insert(std::pair{distances[next], std::size_t{next}});
+                }
+            }
+        }
+        return distances[vertex_count / 2];
+    };
+    BENCHMARK("indexed_priority_queue") {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<std::int64_t>::max());
+        algo::indexed_priority_queue<std::int64_t> heap;
+        distances[0] = 0;
+        heap.insert(0, 0);
+        while (!heap.empty()) {
+            auto const [vertex, distance] = heap.pop();
+            for (auto const& [next, weight] : out_edges(vertex)) {
+                if (distance + weight < distances[next]) {
+                    distances[next] = distance + weight;
+                    heap.contains(next) ? heap.decrease_key(next, distances[next]) : heap.insert(next, distances[next]);
+                }
+            }
+        }
+        return distances[vertex_count / 2];
+    };
+}
+
+TEST_CASE("building and draining a priority_queue in bulk", "[priority_queue][insert_range][pop_n]") {
+    // random values swim up a level or two on average, ascending ones all the way to the root
+    auto const ascending = GENERATE(false, true);
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::int64_t> values(1 << 24);
+    for (auto& value : values) {
+        value = static_cast<std::int64_t>(rand_engine());
+    }
+    if (ascending) {
+        std::sort(values.begin(), values.end());
+    }
+    std::vector<std::int64_t> out(values.size());
+
+    std::string const label = ascending ? ", ascending" : ", random";
+    BENCHMARK("16M inserts" + label) {
+        algo::priority_queue<std::int64_t> heap;
+        for (auto const value : values) {
+            heap.insert(value);
+        }
+        return heap.top();
+    };
+    BENCHMARK("range constructor of 16M" + label) {
+        algo::priority_queue<std::int64_t> heap(values.begin(), values.end());
+        return heap.top();
+    };
+
+    BENCHMARK_ADVANCED("draining 16M one pop at a time" + label)(Catch::Benchmark::Chronometer meter) {
+        algo::priority_queue<std::int64_t> heap(values.begin(), values.end());
+        meter.measure([&] {
+            for (auto& slot : out) {
+                slot = heap.pop();
+            }
+            return out.front();
+        });
+    };
+    BENCHMARK_ADVANCED("draining 16M with pop_n(4096)" + label)(Catch::Benchmark::Chronometer meter) {
+        algo::priority_queue<std::int64_t> heap(values.begin(), values.end());
+        meter.measure([&] {
+            auto next = out.begin();
+            while (!heap.empty()) {
+                next = heap.pop_n(4096, next);
+            }
+            return out.front();
+        });
+    };
+    BENCHMARK_ADVANCED("draining 16M with a single pop_n" + label)(Catch::Benchmark::Chronometer meter) {
+        algo::priority_queue<std::int64_t> heap(values.begin(), values.end());
+        meter.measure([&] {
+            heap.pop_n(values.size(), out.begin());
+            return out.front();
+        });
+    };
+}
+
+TEST_CASE("radix_heap against comparison heaps in an event simulation", "[priority_queue][radix_heap]") {
+    auto const size = GENERATE(std::size_t{1} << 13, std::size_t{1} << 20, std::size_t{1} << 25);
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::int64_t> initial(size);
+    for (auto& time : initial) {
+        time = static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 40));
+    }
+    std::vector<std::int64_t> delays(1 << 21);
+    for (auto& delay : delays) {
+        delay = static_cast<std::int64_t>(rand_engine() % (std::uint64_t{1} << 40));
+    }
+
+    algo::priority_queue<std::int64_t, std::greater<>, 2> binary;
+    algo::priority_queue<std::int64_t, std::greater<>, 4> quaternary;
+    algo::radix_heap<std::int64_t> radix;
+    for (auto const time : initial) {
+        binary.insert(time);
+        quaternary.insert(time);
+        radix.insert(time);
+    }
+
+    auto const label = std::to_string(size * sizeof(std::int64_t) / 1024) + " KiB";
+    BENCHMARK("2-ary, " + label) { return hold(binary, delays); };
+    BENCHMARK("4-ary, " + label) { return hold(quaternary, delays); };
+    BENCHMARK("radix, " + label) { return hold(radix, delays); };
+}
+
+namespace {
+/**
+ * What a double ended queue takes without min_max_heap: a min heap and a max heap of the same elements, each with an id so that an element popped from one
+ * end can be marked dead and skipped when it comes up at the other
+ */
+class dual_heap {
+public:
+    void insert(std::int64_t value) {
+        min_.insert(entry{value, alive_.size()});
+        max_.insert(entry{value, alive_.size()});
+        alive_.push_back(true);
+    }
+    std::int64_t pop_min() { return pop(min_); }
+    std::int64_t pop_max() { return pop(max_); }
+
+private:
+    struct entry {
+        std::int64_t value_;
+        std::size_t id_;
+    };
+    struct by_value_greater {
+        bool operator()(entry const& lhs, entry const& rhs) const noexcept { return lhs.value_ > rhs.value_; }
+    };
+    struct by_value_less {
+        bool operator()(entry const& lhs, entry const& rhs) const noexcept { return lhs.value_ < rhs.value_; }
+    };
+
+    template <typename Heap>
+    std::int64_t pop(Heap& heap) {
+        while (!alive_[heap.top().id_]) {
+            heap.pop();
+        }
+        auto const popped = heap.pop();
+        alive_[popped.id_] = false;
+        return popped.value_;
+    }
+
+    algo::priority_queue<entry, by_value_greater> min_;
+    algo::priority_queue<entry, by_value_less> max_;
+    std::vector<bool> alive_;
+};
+
+/**
+ * A bounded buffer: every value goes in, the least one is evicted once the buffer is over capacity, and now and then the greatest one is taken out
+ */
+template <typename Heap>
+std::int64_t bounded_buffer(Heap& heap, std::size_t capacity, std::vector<std::int64_t> const& values) {
+    std::int64_t sum = 0;
+    std::size_t size = 0;
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        heap.insert(values[i]);
+        if (++size > capacity) {
+            sum += heap.pop_min();
+            --size;
+        }
+        if (i % 8 == 0) {
+            sum += heap.pop_max();
+            --size;
+        }
+    }
+    return sum;
+}
+}  // namespace
+
+TEST_CASE("min_max_heap against a min heap and a max heap with lazy deletion", "[min_max_heap]") {
+    auto const capacity = GENERATE(std::size_t{1} << 10, std::size_t{1} << 16, std::size_t{1} << 20);
+    std::mt19937_64 rand_engine{42};
+    std::vector<std::int64_t> values(std::size_t{1} << 21);
+    for (auto& value : values) {
+        value = static_cast<std::int64_t>(rand_engine() >> 1);
+    }
+
+    auto const label = std::to_string(capacity) + " elements";
+    BENCHMARK_ADVANCED("two heaps, " + label)(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] {
+            dual_heap heap;
+            return bounded_buffer(heap, capacity, values);
+        });
+    };
+    BENCHMARK_ADVANCED("min_max_heap, " + label)(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] {
+            algo::min_max_heap<std::int64_t> heap;
+            return bounded_buffer(heap, capacity, values);
+        });
+    };
+}
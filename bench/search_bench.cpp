@@ -0,0 +1,129 @@
+#include <search.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("searches from L1 to beyond the last level cache", "[lower_bound][eytzinger_array][static_search_tree]") {
+    // 4 KiB up to 512 MiB of ints, every benchmark runs the same 1M random lookups and sums the results so that none of them are optimised away
+    auto const size = GENERATE(std::size_t{1} << 10, std::size_t{1} << 14, std::size_t{1} << 18, std::size_t{1} << 22, std::size_t{1} << 27);
+    std::vector<int> sorted(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        sorted[i] = static_cast<int>(2 * i);
+    }
+    algo::eytzinger_array<int> const eytzinger(sorted.begin(), sorted.end());
+    algo::static_search_tree const tree(sorted.begin(), sorted.end());
+
+    std::mt19937_64 rand_engine{42};
+    std::vector<int> lookups(1 << 20);
+    std::generate(lookups.begin(), lookups.end(), [&] { return static_cast<int>(rand_engine() % (2 * size - 1)); });
+
+    auto const label = std::to_string(size * sizeof(int) / 1024) + " KiB";
+    BENCHMARK("std::lower_bound, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += *std::lower_bound(sorted.begin(), sorted.end(), lookup);
+        }
+        return sum;
+    };
+    BENCHMARK("algo::lower_bound, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += *algo::lower_bound(sorted.begin(), sorted.end(), lookup);
+        }
+        return sum;
+    };
+    BENCHMARK("eytzinger_array::lower_bound, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += *eytzinger.lower_bound(lookup);
+        }
+        return sum;
+    };
+    BENCHMARK("static_search_tree::lower_bound, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += *tree.lower_bound(lookup);
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("binary searches interleaved in batches", "[binary_search]") {
+    auto const size = GENERATE(std::size_t{1} << 14, std::size_t{1} << 22, std::size_t{1} << 27);
+    std::vector<int> sorted(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        sorted[i] = static_cast<int>(2 * i);
+    }
+
+    std::mt19937_64 rand_engine{42};
+    std::vector<int> lookups(1 << 20);
+    std::generate(lookups.begin(), lookups.end(), [&] { return static_cast<int>(rand_engine() % (2 * size - 1)); });
+    std::vector<std::vector<int>::iterator> found(lookups.size());
+
+    auto const label = std::to_string(size * sizeof(int) / 1024) + " KiB";
+    BENCHMARK("algo::binary_search, " + label) {
+        std::size_t hits = 0;
+        for (auto const lookup : lookups) {
+            hits += algo::binary_search(sorted.begin(), sorted.end(), lookup) != sorted.end();
+        }
+        return hits;
+    };
+    BENCHMARK("algo::binary_search_batch, " + label) {
+        algo::binary_search_batch(sorted.begin(), sorted.end(), lookups, found);
+        return std::count_if(found.begin(), found.end(), [&](auto it) { return it != sorted.end(); });
+    };
+}
+
+TEST_CASE("searches that exploit where the answer is", "[exponential_lower_bound][interpolation_lower_bound]") {
+    auto const size = GENERATE(std::size_t{1} << 14, std::size_t{1} << 22, std::size_t{1} << 27);
+    // uniformly distributed keys, so interpolation has something to work with
+    std::mt19937_64 rand_engine{42};
+    std::vector<int> sorted(size);
+    std::generate(sorted.begin(), sorted.end(), [&] { return static_cast<int>(rand_engine() % (std::uint64_t{1} << 31)); });
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<int> lookups(1 << 20);
+    std::generate(lookups.begin(), lookups.end(), [&] { return static_cast<int>(rand_engine() % (std::uint64_t{1} << 31)); });
+    // increasing lookups, each a few elements past the previous one, like successive timestamps
+    std::vector<int> ascending_lookups(lookups.size());
+    for (std::size_t i = 0; i != ascending_lookups.size(); ++i) {
+        ascending_lookups[i] = sorted[(i * 7) % size];
+    }
+    std::sort(ascending_lookups.begin(), ascending_lookups.end());
+
+    auto const label = std::to_string(size * sizeof(int) / 1024) + " KiB";
+    BENCHMARK("algo::lower_bound, ascending, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : ascending_lookups) {
+            sum += *algo::lower_bound(sorted.begin(), sorted.end(), lookup);
+        }
+        return sum;
+    };
+    BENCHMARK("algo::exponential_lower_bound from the previous answer, ascending, " + label) {
+        std::int64_t sum = 0;
+        auto finger = sorted.begin();
+        for (auto const lookup : ascending_lookups) {
+            finger = algo::exponential_lower_bound(sorted.begin(), sorted.end(), finger, lookup);
+            sum += *finger;
+        }
+        return sum;
+    };
+    BENCHMARK("algo::lower_bound, uniform, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += algo::lower_bound(sorted.begin(), sorted.end(), lookup) - sorted.begin();
+        }
+        return sum;
+    };
+    BENCHMARK("algo::interpolation_lower_bound, uniform, " + label) {
+        std::int64_t sum = 0;
+        for (auto const lookup : lookups) {
+            sum += algo::interpolation_lower_bound(sorted.begin(), sorted.end(), lookup) - sorted.begin();
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,356 @@
+#include <sort.h>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace {
+std::vector<int> random_ints(std::size_t size) {
+    std::mt19937_64 rand_engine{42};
+    std::uniform_int_distribution<int> distribution{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+
+    std::vector<int> vec(size);
+    std::generate(vec.begin(), vec.end(), [&] { return distribution(rand_engine); });
+    return vec;
+}
+
+/**
+ * McIlroy's "A Killer Adversary for Quicksort", run against introsort so that its pivot selection is what gets attacked
+ */
+std::vector<int> quick_sort_killer(std::size_t size) {
+    int const gas = static_cast<int>(size);
+    int solid = 0;
+    int candidate = 0;
+    std::vector<int> values(size, gas);
+    std::vector<int> indices(size);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    algo::quick_sort(indices.begin(), indices.end(), algo::introsort, [&](int lhs, int rhs) {
+        if (values[lhs] == gas && values[rhs] == gas) {
+            values[lhs == candidate ? lhs : rhs] = solid++;
+        }
+        if (values[lhs] == gas) {
+            candidate = lhs;
+        } else if (values[rhs] == gas) {
+            candidate = rhs;
+        }
+        return values[lhs] < values[rhs];
+    });
+    return values;
+}
+
+/**
+ * Runs `f` on a fresh copy of `input` every time, so that no run sorts what the previous one already sorted. The copies are made up front and not timed.
+ */
+template <typename Input, typename F>
+void measure_on_copies(Catch::Benchmark::Chronometer& meter, Input const& input, F f) {
+    std::vector<Input> copies(static_cast<std::size_t>(meter.runs()), input);
+    meter.measure([&](int run) { return f(copies[static_cast<std::size_t>(run)]); });
+}
+
+std::vector<std::pair<std::string, std::vector<int>>> input_patterns(std::size_t size) {
+    std::vector<int> sorted(size);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<int> organ_pipe = sorted;
+    std::reverse(organ_pipe.begin() + static_cast<std::ptrdiff_t>(size / 2), organ_pipe.end());
+
+    return {{"random", random_ints(size)},
+            {"sorted", sorted},
+            {"reversed", {sorted.rbegin(), sorted.rend()}},
+            {"organ pipe", organ_pipe},
+            {"killer", quick_sort_killer(size)}};
+}
+}  // namespace
+
+TEST_CASE("introsort on adversarial patterns", "[quick_sort][introsort]") {
+    for (auto const& [name, input] : input_patterns(1 << 20)) {
+        BENCHMARK_ADVANCED("quick_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end()); });
+        };
+        BENCHMARK_ADVANCED("introsort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+        };
+        BENCHMARK_ADVANCED("std::sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { std::sort(vec.begin(), vec.end()); });
+        };
+    }
+}
+
+TEST_CASE("merge_sort on presorted input", "[merge_sort]") {
+    // ascending runs like event log batches, every run ends in a short tail of events that arrived late and belong somewhere in the run
+    // kept small because insertion_sort is quadratic in how far the late events have to travel
+    std::size_t const size = 1 << 18;
+    std::size_t const run_length = 1 << 14;
+    std::mt19937_64 rand_engine{42};
+    std::vector<int> runs(size);
+    for (std::size_t run = 0; run != size; run += run_length) {
+        std::iota(runs.begin() + static_cast<std::ptrdiff_t>(run), runs.begin() + static_cast<std::ptrdiff_t>(run + run_length), static_cast<int>(run / 2));
+        for (std::size_t i = run + run_length - 16; i != run + run_length; ++i) {
+            runs[i] = static_cast<int>(run / 2 + rand_engine() % run_length);
+        }
+    }
+    std::vector<int> nearly_sorted(size);
+    std::iota(nearly_sorted.begin(), nearly_sorted.end(), 0);
+    for (std::size_t i = 0; i != size / 1000; ++i) {
+        std::swap(nearly_sorted[rand_engine() % size], nearly_sorted[rand_engine() % size]);
+    }
+
+    std::vector<int> buffer;
+    for (auto const& [name, input] : std::vector<std::pair<std::string, std::vector<int>>>{{"runs with late tails", runs}, {"0.1% swapped", nearly_sorted}}) {
+        BENCHMARK_ADVANCED("merge_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::merge_sort(vec.begin(), vec.end(), buffer); });
+        };
+        BENCHMARK_ADVANCED("insertion_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::insertion_sort(vec.begin(), vec.end()); });
+        };
+        BENCHMARK_ADVANCED("quick_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+        };
+        BENCHMARK_ADVANCED("std::stable_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { std::stable_sort(vec.begin(), vec.end()); });
+        };
+    }
+
+    auto const random = random_ints(size);
+    BENCHMARK_ADVANCED("merge_sort, random")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, random, [&](auto& vec) { algo::merge_sort(vec.begin(), vec.end(), buffer); });
+    };
+    BENCHMARK_ADVANCED("std::stable_sort, random")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, random, [&](auto& vec) { std::stable_sort(vec.begin(), vec.end()); });
+    };
+}
+
+TEST_CASE("heap_sort", "[heap_sort]") {
+    auto const input = random_ints(1 << 20);
+
+    BENCHMARK_ADVANCED("heap_sort, 1M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::heap_sort(vec.begin(), vec.end()); });
+    };
+    BENCHMARK_ADVANCED("std::make_heap + std::sort_heap, 1M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) {
+            std::make_heap(vec.begin(), vec.end());
+            std::sort_heap(vec.begin(), vec.end());
+        });
+    };
+}
+
+TEST_CASE("three-way quick_sort on duplicate heavy keys", "[quick_sort][three_way]") {
+    for (int distinct_keys : {4, 64, 1 << 30}) {
+        auto input = random_ints(1 << 22);
+        for (auto& i : input) {
+            i = std::abs(i % distinct_keys);
+        }
+
+        auto const name = std::to_string(distinct_keys) + " distinct keys";
+        BENCHMARK_ADVANCED("three-way quick_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::three_way); });
+        };
+        BENCHMARK_ADVANCED("introsort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+        };
+        BENCHMARK_ADVANCED("std::sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { std::sort(vec.begin(), vec.end()); });
+        };
+    }
+}
+
+TEST_CASE("block partition against Hoare partition", "[partition]") {
+    // the median goes last so that both partitions do the same amount of swapping, as they would on a well chosen pivot
+    auto const input = [] {
+        auto vec = random_ints(1 << 22);
+        auto sorted = vec;
+        std::sort(sorted.begin(), sorted.end());
+        std::iter_swap(std::find(vec.begin(), vec.end(), sorted[sorted.size() / 2]), vec.end() - 1);
+        return vec;
+    }();
+    auto const size = static_cast<double>(input.size());
+
+    auto cycles_per_element = [&](auto partition) {
+        auto vec = input;
+        std::less<> comp;
+#if defined(__x86_64__) || defined(__i386__)
+        auto const start = __rdtsc();
+        partition(vec.begin(), vec.end(), comp);
+        return static_cast<double>(__rdtsc() - start) / size;
+#else
+        auto const start = std::chrono::steady_clock::now();
+        partition(vec.begin(), vec.end(), comp);
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) / size;
+#endif
+    };
+
+    auto const hoare = cycles_per_element([](auto begin, auto end, auto& comp) { return algo::sort_details::hoare_partition_pivot_last(begin, end, comp); });
+    auto const block = cycles_per_element([](auto begin, auto end, auto& comp) { return algo::sort_details::block_partition_pivot_last(begin, end, comp); });
+    // nanoseconds instead of cycles where there is no time stamp counter
+    std::cout << "partition of 4M random ints, cycles per element: hoare " << hoare << ", block " << block << '\n';
+
+    BENCHMARK_ADVANCED("hoare partition, 4M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) {
+            std::less<> comp;
+            return algo::sort_details::hoare_partition_pivot_last(vec.begin(), vec.end(), comp);
+        });
+    };
+    BENCHMARK_ADVANCED("block partition, 4M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) {
+            std::less<> comp;
+            return algo::sort_details::block_partition_pivot_last(vec.begin(), vec.end(), comp);
+        });
+    };
+}
+
+TEST_CASE("SIMD kernels against scalar leaves and partitions", "[simd]") {
+    auto const input = random_ints(1 << 24);
+    // a lambda comparator does the same as std::less but keeps every algorithm on its scalar code
+    auto const scalar_less = [](int lhs, int rhs) { return lhs < rhs; };
+
+    BENCHMARK_ADVANCED("insertion_sort 64 element leaves, scalar")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) {
+            for (auto it = vec.begin(); it != vec.end(); it += 64) {
+                algo::insertion_sort(it, it + 64, scalar_less);
+            }
+        });
+    };
+    BENCHMARK_ADVANCED("insertion_sort 64 element leaves, SIMD")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) {
+            for (auto it = vec.begin(); it != vec.end(); it += 64) {
+                algo::insertion_sort(it, it + 64);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("partition 16M ints, scalar")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { return algo::sort_details::partition_pivot_last(vec.begin(), vec.end(), scalar_less); });
+    };
+    BENCHMARK_ADVANCED("partition 16M ints, SIMD")(Catch::Benchmark::Chronometer meter) {
+        std::less<> comp;
+        measure_on_copies(meter, input, [&](auto& vec) { return algo::sort_details::partition_pivot_last(vec.begin(), vec.end(), comp); });
+    };
+
+    BENCHMARK_ADVANCED("introsort 16M ints, scalar")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort, scalar_less); });
+    };
+    BENCHMARK_ADVANCED("introsort 16M ints, SIMD")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+    };
+}
+
+TEST_CASE("parallel quick_sort scaling", "[quick_sort][parallel]") {
+    auto const input = random_ints(1 << 24);
+
+    std::vector<std::size_t> thread_counts{1, 2, 4, 8, 16};
+    thread_counts.push_back(std::max(std::thread::hardware_concurrency(), 1U));
+
+    for (auto thread_count : thread_counts) {
+        BENCHMARK_ADVANCED("quick_sort 16M ints, " + std::to_string(thread_count) + " threads")(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), thread_count); });
+        };
+    }
+}
+
+TEST_CASE("sample_sort scaling", "[sample_sort][parallel]") {
+    // 128M ints, 512 MiB, well past any cache. A billion elements just take 8 times as long once the sort runs at the memory bandwidth.
+    auto const input = random_ints(1 << 27);
+
+    std::vector<std::size_t> thread_counts{1, 2, 4, 8, 16};
+    thread_counts.push_back(std::max(std::thread::hardware_concurrency(), 1U));
+
+    for (auto thread_count : thread_counts) {
+        BENCHMARK_ADVANCED("sample_sort 128M ints, " + std::to_string(thread_count) + " threads")(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::sample_sort(vec.begin(), vec.end(), thread_count); });
+        };
+        BENCHMARK_ADVANCED("quick_sort 128M ints, " + std::to_string(thread_count) + " threads")(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), thread_count); });
+        };
+    }
+}
+
+TEST_CASE("radix sorts against comparison sorts", "[radix_sort]") {
+    std::size_t const size = 10'000'000;
+    std::mt19937_64 rand_engine{42};
+
+    std::vector<std::uint32_t> uint32s(size);
+    std::vector<std::int64_t> int64s(size);
+    std::vector<double> doubles(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        uint32s[i] = static_cast<std::uint32_t>(rand_engine());
+        int64s[i] = static_cast<std::int64_t>(rand_engine());
+        doubles[i] = std::uniform_real_distribution<double>{-1e9, 1e9}(rand_engine);
+    }
+
+    auto run = [](std::string const& name, auto const& input) {
+        BENCHMARK_ADVANCED("radix_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::radix_sort(vec.begin(), vec.end()); });
+        };
+        BENCHMARK_ADVANCED("msd_radix_sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::msd_radix_sort(vec.begin(), vec.end()); });
+        };
+        BENCHMARK_ADVANCED("introsort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+        };
+        BENCHMARK_ADVANCED("std::sort, " + name)(Catch::Benchmark::Chronometer meter) {
+            measure_on_copies(meter, input, [&](auto& vec) { std::sort(vec.begin(), vec.end()); });
+        };
+    };
+
+    run("10M uint32", uint32s);
+    run("10M int64", int64s);
+    run("10M double", doubles);
+}
+
+TEST_CASE("selection against sorting", "[nth_element][partial_sort]") {
+    auto const input = random_ints(50'000'000);
+    auto const middle = static_cast<std::ptrdiff_t>(input.size() / 2);
+
+    BENCHMARK_ADVANCED("nth_element median of 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::nth_element(vec.begin(), vec.begin() + middle, vec.end()); });
+    };
+    BENCHMARK_ADVANCED("std::nth_element median of 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { std::nth_element(vec.begin(), vec.begin() + middle, vec.end()); });
+    };
+    BENCHMARK_ADVANCED("introsort 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+    };
+
+    BENCHMARK_ADVANCED("select_k top 100 of 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::select_k(vec.begin(), vec.end(), 100, std::greater<>{}); });
+    };
+    BENCHMARK_ADVANCED("partial_sort top 100 of 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { algo::partial_sort(vec.begin(), vec.begin() + 100, vec.end(), std::greater<>{}); });
+    };
+    BENCHMARK_ADVANCED("std::partial_sort top 100 of 50M ints")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, input, [&](auto& vec) { std::partial_sort(vec.begin(), vec.begin() + 100, vec.end(), std::greater<>{}); });
+    };
+}
+
+TEST_CASE("string_sort on URLs with long common prefixes", "[string_sort]") {
+    // 2M URLs rather than 10M, every run sorts a fresh copy and 10M strings times the copies do not fit in memory everywhere
+    std::mt19937_64 rand_engine{42};
+    std::array<std::string_view, 4> const hosts{"https://www.example.com/", "https://www.example.org/", "https://shop.example.com/",
+                                                "http://cdn.example.net/static/"};
+    std::vector<std::string> urls;
+    for (std::size_t i = 0; i != 2'000'000; ++i) {
+        urls.push_back(std::string{hosts[rand_engine() % hosts.size()]} + "api/v2/catalogue/products/region/europe/language/en-gb/category-" +
+                       std::to_string(rand_engine() % 50) + "/item-" + std::to_string(rand_engine() % 1'000'000) + "?ref=newsletter");
+    }
+
+    BENCHMARK_ADVANCED("string_sort 2M URLs")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, urls, [](auto& vec) { algo::string_sort(vec.begin(), vec.end()); });
+    };
+    BENCHMARK_ADVANCED("introsort 2M URLs")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, urls, [](auto& vec) { algo::quick_sort(vec.begin(), vec.end(), algo::introsort); });
+    };
+    BENCHMARK_ADVANCED("std::sort 2M URLs")(Catch::Benchmark::Chronometer meter) {
+        measure_on_copies(meter, urls, [](auto& vec) { std::sort(vec.begin(), vec.end()); });
+    };
+}
@@ -0,0 +1,49 @@
+#include <top_k.h>
+
+#include <catch2/catch.hpp>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("top k of a stream of scores", "[top_k]") {
+    auto const k = GENERATE(std::size_t{10}, std::size_t{1000}, std::size_t{100000});
+    std::mt19937_64 rand_engine{42};
+    std::uniform_real_distribution<float> distribution{0.0F, 1.0F};
+    std::vector<float> scores(std::size_t{1} << 24);
+    for (auto& score : scores) {
+        score = distribution(rand_engine);
+    }
+
+    auto const label = "k = " + std::to_string(k);
+    BENCHMARK("std::priority_queue, " + label) {
+        std::priority_queue<float, std::vector<float>, std::greater<>> heap;
+        for (auto const score : scores) {
+            if (heap.size() < k) {
+                heap.push(score);
+            } else if (heap.top() < score) {
+                heap.pop();
+                heap.push(score);
+            }
+        }
+        return heap.top();
+    };
+    BENCHMARK("offer, " + label) {
+        algo::top_k<float> top{k};
+        for (auto const score : scores) {
+            top.offer(score);
+        }
+        return top.threshold();
+    };
+    BENCHMARK("offer_batch, scalar, " + label) {
+        algo::top_k<float> top{k, {}, algo::simd_level::scalar};
+        top.offer_batch(scores);
+        return top.threshold();
+    };
+    BENCHMARK("offer_batch, SIMD, " + label) {
+        algo::top_k<float> top{k};
+        top.offer_batch(scores);
+        return top.threshold();
+    };
+}
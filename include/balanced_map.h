@@ -1,7 +1,12 @@
 #ifndef ALGO_LAND_BALANCED_MAP_H
 #define ALGO_LAND_BALANCED_MAP_H
 
+#include <interleave.h>
+
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <stdexcept>
 
 namespace algo {
 namespace rb_details {
@@ -88,6 +93,19 @@ public:
         return target->value();
     }
 
+    /**
+     * Looks up all of `keys` at once with `group_size` lookups interleaved so that their cache misses overlap, see `run_interleaved`
+     * @param out receives a pointer to the value of every key, nullptr for keys that do not exist
+     * @throws std::invalid_argument when `out` is shorter than `keys`
+     */
+    void find_batch(std::span<K const> keys, std::span<value_type*> out, std::size_t group_size = default_interleave_group) {
+        find_batch_in_tree(header_.next_node_.get(), keys, out, group_size);
+    }
+
+    void find_batch(std::span<K const> keys, std::span<value_type const*> out, std::size_t group_size = default_interleave_group) const {
+        find_batch_in_tree(header_.next_node_.get(), keys, out, group_size);
+    }
+
 private:
     using edge_type = typename node_type::edge_type;
     constexpr node_type* find(node_type* node, key_type& key) const noexcept;
@@ -0,0 +1,413 @@
+#ifndef ALGO_LAND_EXTERNAL_SORT_H
+#define ALGO_LAND_EXTERNAL_SORT_H
+
+#include <merge.h>
+#include <sort.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+struct external_sort_options {
+    /**
+     * Upper bound on the memory used for records, in bytes. Run formation sorts chunks of this size, merging splits it into I/O blocks.
+     */
+    std::size_t memory_limit = std::size_t{1} << 30;
+
+    /**
+     * Where the sorted runs are spilled to, ideally a different disk than the input and the output
+     */
+    std::filesystem::path temp_directory = std::filesystem::temp_directory_path();
+};
+
+namespace external_details {
+/**
+ * Blocks are never made bigger than this, past a few MiB sequential I/O does not get any faster and the memory is better spent on merging more runs at once
+ */
+inline constexpr std::size_t max_block_bytes = std::size_t{16} << 20;
+
+/**
+ * Nor smaller than this, unless the memory limit is tiny, since too small blocks turn the merge into random I/O
+ */
+inline constexpr std::size_t min_block_bytes = std::size_t{64} << 10;
+
+/**
+ * Nor are more runs merged at once than this, whatever the memory limit: every run being merged holds an open file and an I/O thread, and a few hundred of
+ * those stay well below the usual limits on both. More runs than that are merged in several passes.
+ */
+inline constexpr std::size_t max_merge_fan_in = 256;
+
+/**
+ * @return how many runs one merge pass takes at most, with every run being merged and the output double buffered in blocks of at least
+ * `min_block_records`
+ */
+[[nodiscard]] constexpr std::size_t merge_fan_in(std::size_t memory_records, std::size_t min_block_records) noexcept {
+    return std::clamp<std::size_t>(memory_records / (2 * min_block_records), 3, max_merge_fan_in + 1) - 1;
+}
+
+struct file_closer {
+    void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+};
+using file_handle = std::unique_ptr<std::FILE, file_closer>;
+
+inline file_handle open_file(std::filesystem::path const& path, char const* mode) {
+    file_handle file{std::fopen(path.c_str(), mode)};
+    if (!file) {
+        throw std::runtime_error{"cannot open " + path.string()};
+    }
+    return file;
+}
+
+template <typename Record>
+std::size_t read_records(std::FILE* file, Record* records, std::size_t count) {
+    auto const read = std::fread(records, sizeof(Record), count, file);
+    if (read != count && std::ferror(file)) {
+        throw std::runtime_error{"reading records failed"};
+    }
+    return read;
+}
+
+template <typename Record>
+void write_records(std::FILE* file, Record const* records, std::size_t count) {
+    if (std::fwrite(records, sizeof(Record), count, file) != count) {
+        throw std::runtime_error{"writing records failed"};
+    }
+}
+
+/**
+ * Temporary run files, removed again when this goes out of scope
+ */
+class temp_files {
+public:
+    explicit temp_files(std::filesystem::path directory) : directory_{std::move(directory)}, prefix_{"algo_external_sort_" + random_suffix()} {}
+
+    temp_files(temp_files const&) = delete;
+    temp_files& operator=(temp_files const&) = delete;
+
+    ~temp_files() {
+        for (auto const& path : paths_) {
+            std::error_code ignored;
+            std::filesystem::remove(path, ignored);
+        }
+    }
+
+    std::filesystem::path create() { return paths_.emplace_back(directory_ / (prefix_ + '_' + std::to_string(paths_.size()))); }
+
+    void remove(std::filesystem::path const& path) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+
+private:
+    static std::string random_suffix() {
+        std::random_device seeder;
+        return std::to_string(seeder()) + std::to_string(seeder());
+    }
+
+    std::filesystem::path directory_;
+    std::string prefix_;
+    std::vector<std::filesystem::path> paths_;
+};
+
+/**
+ * A thread that lives as long as the reader or writer owning it and runs the I/O jobs it is handed one at a time, so that double buffering starts one
+ * thread per file rather than one per block
+ */
+class io_thread {
+public:
+    io_thread() : thread_{[this] { loop(); }} {}
+
+    io_thread(io_thread const&) = delete;
+    io_thread& operator=(io_thread const&) = delete;
+
+    /**
+     * Finishes the job in flight, if any, before the thread exits
+     */
+    ~io_thread() {
+        {
+            std::lock_guard lock{mutex_};
+            stop_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    /**
+     * Hands `job` to the thread, the job handed over before has to be waited for first
+     */
+    void start(std::function<void()> job) {
+        {
+            std::lock_guard lock{mutex_};
+            job_ = std::move(job);
+            busy_ = true;
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * Blocks until the last job handed over is done, rethrowing what escaped it
+     */
+    void wait() {
+        std::unique_lock lock{mutex_};
+        done_.wait(lock, [this] { return !busy_; });
+        if (exception_) {
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+    }
+
+private:
+    void loop() {
+        std::unique_lock lock{mutex_};
+        while (true) {
+            wake_.wait(lock, [this] { return stop_ || job_; });
+            if (!job_) {
+                return;
+            }
+            auto job = std::exchange(job_, nullptr);
+            lock.unlock();
+            std::exception_ptr exception;
+            try {
+                job();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            lock.lock();
+            exception_ = std::move(exception);
+            busy_ = false;
+            done_.notify_one();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::function<void()> job_;
+    std::exception_ptr exception_;
+    bool busy_ = false;
+    bool stop_ = false;
+    // declared last so that everything the loop touches exists before it starts
+    std::thread thread_;
+};
+
+/**
+ * Reads a file of records block by block. While the caller works through one block the next one is already being read on another thread, so the disk never
+ * waits for the merge and the merge rarely waits for the disk.
+ */
+template <typename Record>
+class prefetching_reader {
+public:
+    prefetching_reader(std::filesystem::path const& path, std::size_t block_records)
+        : file_{open_file(path, "rb")}, current_(block_records), next_(block_records) {
+        prefetch();
+    }
+
+    // the read in flight holds on to `this`
+    prefetching_reader(prefetching_reader const&) = delete;
+    prefetching_reader& operator=(prefetching_reader const&) = delete;
+
+    /**
+     * @return the next block of records, empty once the file is exhausted. It stays valid until the next call.
+     */
+    std::span<Record const> next_block() {
+        io_.wait();
+        auto const count = next_count_;
+        std::swap(current_, next_);
+        if (count != 0) {
+            prefetch();
+        }
+        return {current_.data(), count};
+    }
+
+private:
+    void prefetch() {
+        io_.start([this] { next_count_ = read_records(file_.get(), next_.data(), next_.size()); });
+    }
+
+    file_handle file_;
+    std::vector<Record> current_;
+    std::vector<Record> next_;
+    std::size_t next_count_ = 0;
+    // declared last so that it is destroyed first, which waits for a read still in flight
+    io_thread io_;
+};
+
+/**
+ * Writes records block by block, a full block is written out on another thread while the next one fills up
+ */
+template <typename Record>
+class double_buffered_writer {
+public:
+    double_buffered_writer(std::filesystem::path const& path, std::size_t block_records) : file_{open_file(path, "wb")} {
+        current_.reserve(block_records);
+        writing_.reserve(block_records);
+    }
+
+    // the write in flight holds on to `this`
+    double_buffered_writer(double_buffered_writer const&) = delete;
+    double_buffered_writer& operator=(double_buffered_writer const&) = delete;
+
+    void push(Record const& record) {
+        current_.push_back(record);
+        if (current_.size() == current_.capacity()) {
+            flush();
+        }
+    }
+
+    /**
+     * Writes out everything pushed so far. Must be called before destruction, otherwise write errors go unnoticed.
+     */
+    void finish() {
+        flush();
+        io_.wait();
+        if (std::fflush(file_.get()) != 0) {
+            throw std::runtime_error{"writing records failed"};
+        }
+    }
+
+private:
+    void flush() {
+        io_.wait();
+        std::swap(current_, writing_);
+        current_.clear();
+        io_.start([this] { write_records(file_.get(), writing_.data(), writing_.size()); });
+    }
+
+    file_handle file_;
+    std::vector<Record> current_;
+    std::vector<Record> writing_;
+    // declared last so that it is destroyed first, which waits for a write still in flight
+    io_thread io_;
+};
+
+/**
+ * Merges sorted run files into one sorted file through a loser tree of the runs, every output record costs one replay of the tournament
+ */
+template <typename Record, typename Compare>
+void merge_files(std::vector<std::filesystem::path> const& runs, std::filesystem::path const& output, std::size_t block_records, Compare& comp) {
+    class cursor {
+    public:
+        cursor(std::filesystem::path const& run, std::size_t block_records)
+            : reader_{std::make_unique<prefetching_reader<Record>>(run, block_records)}, block_{reader_->next_block()} {}
+
+        [[nodiscard]] bool empty() const noexcept { return block_.empty(); }
+        [[nodiscard]] Record const& front() const noexcept { return block_[position_]; }
+        void advance() {
+            if (++position_ == block_.size()) {
+                block_ = reader_->next_block();
+                position_ = 0;
+            }
+        }
+
+    private:
+        // the reader cannot move, the cursor has to for the tree
+        std::unique_ptr<prefetching_reader<Record>> reader_;
+        std::span<Record const> block_;
+        std::size_t position_ = 0;
+    };
+
+    std::vector<cursor> cursors;
+    cursors.reserve(runs.size());
+    for (auto const& run : runs) {
+        cursors.emplace_back(run, block_records);
+    }
+
+    double_buffered_writer<Record> writer{output, block_records};
+    for (loser_tree tree{std::move(cursors), std::ref(comp)}; !tree.empty(); tree.advance()) {
+        writer.push(tree.front());
+    }
+    writer.finish();
+}
+}  // namespace external_details
+
+/**
+ * External merge sort of a file of fixed width records, for data that does not fit in memory. The input is read in chunks of `options.memory_limit` bytes,
+ * every chunk is sorted in memory with introsort and spilled to a run file in `options.temp_directory`, then the runs are k-way merged into `output` with
+ * double-buffered, prefetching block I/O. Should there be more runs than the memory limit allows blocks for, they are merged in several passes. Sorting
+ * 100 GB on 16 GB of memory takes 7 runs and a single merge pass, so every record is read and written twice.
+ * @tparam Record the record type, the file holds nothing but records laid out back to back
+ * @param input the file to sort, its size must be a multiple of sizeof(Record)
+ * @param output where the sorted records go, may not be the input
+ * @throws std::runtime_error when a file cannot be opened, read or written
+ * @throws std::invalid_argument when the memory limit cannot hold two records or the input is no whole number of records
+ */
+template <typename Record, typename Compare = std::less<>>
+requires std::is_trivially_copyable_v<Record> && std::default_initializable<Record>
+void external_sort(std::filesystem::path const& input, std::filesystem::path const& output, external_sort_options const& options = {}, Compare comp = {}) {
+    using namespace external_details;
+
+    auto const memory_records = options.memory_limit / sizeof(Record);
+    if (memory_records < 2) {
+        throw std::invalid_argument{"the memory limit must hold at least two records"};
+    }
+    if (std::filesystem::file_size(input) % sizeof(Record) != 0) {
+        throw std::invalid_argument{input.string() + " does not hold a whole number of records"};
+    }
+
+    auto const min_block_records = std::max<std::size_t>(1, std::min(min_block_bytes / sizeof(Record), memory_records / 16));
+    auto const max_block_records = std::max<std::size_t>(1, max_block_bytes / sizeof(Record));
+    auto const max_fan_in = merge_fan_in(memory_records, min_block_records);
+    auto const block_records_for = [&](std::size_t fan_in) { return std::clamp(memory_records / (2 * (fan_in + 1)), min_block_records, max_block_records); };
+
+    temp_files temp{options.temp_directory};
+    std::vector<std::filesystem::path> runs;
+
+    // run formation
+    {
+        auto in = open_file(input, "rb");
+        std::vector<Record> chunk(memory_records);
+        while (auto const count = read_records(in.get(), chunk.data(), chunk.size())) {
+            auto const chunk_end = chunk.begin() + static_cast<std::ptrdiff_t>(count);
+            quick_sort(chunk.begin(), chunk_end, introsort, comp);
+
+            // a single run is the result already
+            bool const only_run = runs.empty() && count < chunk.size();
+            auto const& run = runs.emplace_back(only_run ? output : temp.create());
+            auto out = open_file(run, "wb");
+            write_records(out.get(), chunk.data(), count);
+            if (std::fflush(out.get()) != 0) {
+                throw std::runtime_error{"writing records failed"};
+            }
+            if (only_run) {
+                return;
+            }
+        }
+    }
+
+    if (runs.empty()) {
+        open_file(output, "wb");
+        return;
+    }
+
+    // merge passes, only the last one goes to the output
+    while (runs.size() > max_fan_in) {
+        std::vector<std::filesystem::path> merged;
+        for (std::size_t first = 0; first < runs.size(); first += max_fan_in) {
+            std::vector<std::filesystem::path> group(runs.begin() + static_cast<std::ptrdiff_t>(first),
+                                                     runs.begin() + static_cast<std::ptrdiff_t>(std::min(first + max_fan_in, runs.size())));
+            merge_files<Record>(group, merged.emplace_back(temp.create()), block_records_for(group.size()), comp);
+            for (auto const& run : group) {
+                temp.remove(run);
+            }
+        }
+        runs = std::move(merged);
+    }
+    merge_files<Record>(runs, output, block_records_for(runs.size()), comp);
+}
+}  // namespace algo
+#endif  // ALGO_LAND_EXTERNAL_SORT_H
@@ -0,0 +1,110 @@
+#ifndef ALGO_LAND_GENERATOR_H
+#define ALGO_LAND_GENERATOR_H
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace algo {
+
+/**
+ * A lazily evaluated sequence produced by a coroutine that co_yields its elements, pulled one at a time through front() and advance(). The coroutine runs up
+ * to its first co_yield when the generator is first looked at and up to the next one on every advance(), so the yielded element is never copied: front()
+ * refers to it where it lives in the coroutine, which is valid until the next advance(). An exception that escapes the coroutine is rethrown by whichever
+ * call resumed it.
+ * @tparam T the element type, co_yield accepts anything that converts to T const&
+ */
+template <typename T>
+class generator {
+public:
+    using value_type = std::remove_cvref_t<T>;
+
+    struct promise_type {
+        value_type const* current_ = nullptr;
+        std::exception_ptr exception_;
+
+        generator get_return_object() noexcept { return generator{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // a temporary in the co_yield expression lives until the coroutine is resumed, so pointing at it is fine
+        std::suspend_always yield_value(value_type const& value) noexcept {
+            current_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+        // there is nothing to wait for in a generator
+        void await_transform() = delete;
+    };
+
+    generator(generator&& other) noexcept : handle_{std::exchange(other.handle_, {})}, started_{other.started_} {}
+
+    generator& operator=(generator&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+            started_ = other.started_;
+        }
+        return *this;
+    }
+
+    generator(generator const&) = delete;
+    generator& operator=(generator const&) = delete;
+
+    ~generator() { destroy(); }
+
+    [[nodiscard]] bool empty() {
+        start();
+        return !handle_ || handle_.done();
+    }
+
+    /**
+     * @return the element yielded last, may only be called when not empty()
+     */
+    [[nodiscard]] value_type const& front() {
+        start();
+        return *handle_.promise().current_;
+    }
+
+    /**
+     * Runs the coroutine up to its next co_yield, or its end. May only be called when not empty().
+     */
+    void advance() {
+        start();
+        resume();
+    }
+
+private:
+    explicit generator(std::coroutine_handle<promise_type> handle) noexcept : handle_{handle} {}
+
+    // the coroutine is suspended before its body, it runs to the first co_yield only when asked for it
+    void start() {
+        if (!started_ && handle_) {
+            started_ = true;
+            resume();
+        }
+    }
+
+    void resume() {
+        handle_.resume();
+        if (handle_.done() && handle_.promise().exception_) {
+            std::rethrow_exception(std::exchange(handle_.promise().exception_, {}));
+        }
+    }
+
+    void destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+    bool started_ = false;
+};
+}  // namespace algo
+#endif  // ALGO_LAND_GENERATOR_H
@@ -0,0 +1,218 @@
+#ifndef ALGO_LAND_INTERLEAVE_H
+#define ALGO_LAND_INTERLEAVE_H
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+/**
+ * How many lookups run_interleaved keeps in flight by default, about as many cache misses as a core can have outstanding
+ */
+inline constexpr std::size_t default_interleave_group = 16;
+
+namespace interleave_details {
+/**
+ * Recycles coroutine frames. A batch creates one frame per lookup and the lookups of a batch all have frames of the same size, so after the first group a
+ * frame is never allocated from the heap again.
+ */
+class frame_pool {
+public:
+    frame_pool() = default;
+    frame_pool(frame_pool const&) = delete;
+    frame_pool& operator=(frame_pool const&) = delete;
+
+    ~frame_pool() {
+        for (auto* frame : free_) {
+            ::operator delete(frame);
+        }
+    }
+
+    void* allocate(std::size_t size) {
+        if (!free_.empty() && free_.back()->size_ >= size) {
+            auto* frame = free_.back();
+            free_.pop_back();
+            return frame + 1;
+        }
+        auto* frame = static_cast<header*>(::operator new(sizeof(header) + size));
+        frame->size_ = size;
+        return frame + 1;
+    }
+
+    void deallocate(void* memory) noexcept {
+        auto* frame = static_cast<header*>(memory) - 1;
+        if (free_.size() < max_free) {
+            // push_back cannot throw here, the capacity is reserved up front
+            free_.push_back(frame);
+        } else {
+            ::operator delete(frame);
+        }
+    }
+
+    static frame_pool& local() {
+        thread_local frame_pool pool;
+        return pool;
+    }
+
+private:
+    // keeps the frame behind it aligned like operator new would
+    struct alignas(std::max_align_t) header {
+        std::size_t size_;
+    };
+
+    static constexpr std::size_t max_free = 4 * default_interleave_group;
+
+    std::vector<header*> free_ = [] {
+        std::vector<header*> free;
+        free.reserve(max_free);
+        return free;
+    }();
+};
+}  // namespace interleave_details
+
+/**
+ * A lookup written as a coroutine that suspends wherever it would otherwise stall on a cache miss, see `prefetch_and_suspend` and `run_interleaved`. It
+ * starts suspended and delivers its result through whatever it was given to write to.
+ */
+class interleaved_lookup {
+public:
+    struct promise_type {
+        interleaved_lookup get_return_object() noexcept { return interleaved_lookup{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+        static void* operator new(std::size_t size) { return interleave_details::frame_pool::local().allocate(size); }
+        static void operator delete(void* frame) noexcept { interleave_details::frame_pool::local().deallocate(frame); }
+
+        std::exception_ptr exception_;
+    };
+
+    interleaved_lookup(interleaved_lookup&& other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+
+    interleaved_lookup& operator=(interleaved_lookup&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    interleaved_lookup(interleaved_lookup const&) = delete;
+    interleaved_lookup& operator=(interleaved_lookup const&) = delete;
+
+    ~interleaved_lookup() { destroy(); }
+
+    [[nodiscard]] bool done() const noexcept { return handle_.done(); }
+
+    /**
+     * Runs the lookup up to its next suspension or its end, rethrowing what escapes it
+     */
+    void resume() {
+        handle_.resume();
+        if (handle_.done() && handle_.promise().exception_) {
+            std::rethrow_exception(std::exchange(handle_.promise().exception_, {}));
+        }
+    }
+
+private:
+    explicit interleaved_lookup(std::coroutine_handle<promise_type> handle) noexcept : handle_{handle} {}
+
+    void destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * `co_await prefetch_and_suspend{address}` asks for the cache line at `address` and lets the other lookups run while it arrives
+ */
+struct prefetch_and_suspend {
+    explicit prefetch_and_suspend([[maybe_unused]] void const* address) noexcept {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+    constexpr void await_suspend(std::coroutine_handle<>) const noexcept {}
+    constexpr void await_resume() const noexcept {}
+};
+
+/**
+ * Runs `count` lookups with `group_size` of them in flight at once, resuming them round robin. A lookup that suspends on a prefetch is only resumed after
+ * all the others in the group had their turn, by which time its cache line has arrived, so the memory latency of one lookup is hidden behind the work of
+ * the others instead of stalling the core. Pointer chasing searches through structures much bigger than the cache get several times faster this way.
+ * @param make_lookup called with 0 to count - 1, returns the interleaved_lookup for that index
+ */
+template <typename MakeLookup>
+void run_interleaved(std::size_t count, MakeLookup make_lookup, std::size_t group_size = default_interleave_group) {
+    auto const group = std::min(count, std::max<std::size_t>(group_size, 1));
+    std::vector<interleaved_lookup> in_flight;
+    in_flight.reserve(group);
+    std::size_t next = 0;
+    while (next != group) {
+        in_flight.push_back(make_lookup(next++));
+    }
+
+    while (!in_flight.empty()) {
+        for (std::size_t slot = 0; slot < in_flight.size();) {
+            in_flight[slot].resume();
+            if (!in_flight[slot].done()) {
+                ++slot;
+            } else if (next != count) {
+                // the slot goes to the next lookup straight away so that the group stays full
+                in_flight[slot] = make_lookup(next++);
+                ++slot;
+            } else {
+                in_flight[slot] = std::move(in_flight.back());
+                in_flight.pop_back();
+            }
+        }
+    }
+}
+
+namespace interleave_details {
+template <typename Node, typename Key, typename Value>
+interleaved_lookup find_in_tree(Node* node, Key const& key, Value*& out) {
+    while (node) {
+        co_await prefetch_and_suspend{node};
+        if (node->key() == key) {
+            out = &node->value();
+            co_return;
+        }
+        // which child comes next is as good as random, so it is looked up in an array rather than left to a branch the predictor would miss half the time
+        Node* const children[]{node->left(), node->right()};
+        node = children[node->key() < key];
+    }
+    out = nullptr;
+}
+}  // namespace interleave_details
+
+/**
+ * Looks up all of `keys` in the binary search tree under `root` with `group_size` lookups interleaved, see `run_interleaved`. `out[i]` is set to the value
+ * of the node holding `keys[i]`, or to nullptr when there is none.
+ * @tparam Node has key(), value(), left() and right()
+ * @throws std::invalid_argument when `out` is shorter than `keys`
+ */
+template <typename Node, typename Key, typename Value>
+void find_batch_in_tree(Node* root, std::span<Key const> keys, std::span<Value*> out, std::size_t group_size = default_interleave_group) {
+    if (out.size() < keys.size()) {
+        throw std::invalid_argument{"the output is shorter than the keys!"};
+    }
+    run_interleaved(
+        keys.size(), [&](std::size_t i) { return interleave_details::find_in_tree(root, keys[i], out[i]); }, group_size);
+}
+}  // namespace algo
+#endif  // ALGO_LAND_INTERLEAVE_H
@@ -1,9 +1,12 @@
 #ifndef ALGO_LAND_MAP_H
 #define ALGO_LAND_MAP_H
 
+#include <interleave.h>
+
 #include <concepts>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <utility>
 
@@ -124,6 +127,20 @@ public:
         return target->value();
     }
 
+    /**
+     * Looks up all of `keys` at once. Every lookup is a coroutine that prefetches the next node and suspends, and `group_size` of them run interleaved, so
+     * their cache misses overlap instead of each lookup waiting for its own, see `run_interleaved`.
+     * @param out receives a pointer to the value of every key, nullptr for keys that do not exist
+     * @throws std::invalid_argument when `out` is shorter than `keys`
+     */
+    void find_batch(std::span<K const> keys, std::span<value_type*> out, std::size_t group_size = default_interleave_group) {
+        find_batch_in_tree(root_.get(), keys, out, group_size);
+    }
+
+    void find_batch(std::span<K const> keys, std::span<value_type const*> out, std::size_t group_size = default_interleave_group) const {
+        find_batch_in_tree(root_.get(), keys, out, group_size);
+    }
+
     void insert(std::pair<K, V>&& key_val) {
         // we walk through every unique pointer until it points to null, meaning we have reached a leaf node
         // the `iter` is is a pointer to a std::unique_ptr, hence double de-referencing is required to get the underlying element
@@ -0,0 +1,201 @@
+#ifndef ALGO_LAND_MERGE_H
+#define ALGO_LAND_MERGE_H
+
+#include <generator.h>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+/**
+ * Anything a k-way merge can pull sorted elements from: front() is the current element, advance() moves past it, both only while not empty().
+ * algo::generator is one, range_source adapts an iterator pair and a loser_tree is one too, so merges can be nested.
+ */
+template <typename Source>
+concept merge_source = std::movable<Source> && requires(Source& source) {
+    { source.empty() } -> std::convertible_to<bool>;
+    source.front();
+    source.advance();
+};
+
+/**
+ * A merge_source over [begin, end)
+ */
+template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel = Iterator>
+class range_source {
+public:
+    range_source(Iterator begin, Sentinel end) : begin_{std::move(begin)}, end_{std::move(end)} {}
+
+    [[nodiscard]] bool empty() const { return begin_ == end_; }
+    [[nodiscard]] decltype(auto) front() const { return *begin_; }
+    void advance() { ++begin_; }
+
+private:
+    Iterator begin_;
+    Sentinel end_;
+};
+
+/**
+ * Merges k sorted sources with a tournament tree that keeps the loser of every match in its inner nodes and the overall winner on top. Taking the winner out
+ * replays only the matches on the path from its leaf to the root, against the losers stored there, so every element costs ceil(log2 k) matches, where
+ * sifting down a binary heap of the sources compares both children on every level. The inner nodes are a flat array of source indices. Small trivially
+ * copyable elements are copied into an array of their own, indexed by source, so a replay never visits the sources and its matches select the new loser
+ * with conditional moves instead of branches that unpredictable input would keep mispredicting.
+ *
+ * The merge is stable: of equal elements, the one from the source that comes first is taken first. A match is a single comparison, whose operands are put in
+ * the order of their sources so that a tie falls to the earlier one. An exhausted source loses every match.
+ * @tparam Source must satisfy merge_source, with elements `Compare` can compare
+ */
+template <merge_source Source, typename Compare = std::less<>>
+class loser_tree {
+public:
+    using value_type = std::remove_cvref_t<decltype(std::declval<Source&>().front())>;
+
+    explicit loser_tree(std::vector<Source> sources, Compare comp = {})
+        : sources_(std::move(sources)), losers_(std::bit_ceil(std::max<std::size_t>(sources_.size(), 1))), exhausted_(losers_.size(), true), comp_{comp} {
+        if constexpr (caches_keys) {
+            keys_.resize(losers_.size());
+        }
+        for (std::size_t source = 0; source != sources_.size(); ++source) {
+            enter(source);
+        }
+
+        // play the tournament bottom up, leaf i sits at leaves + i and node n plays the winners of 2n and 2n + 1. The leaves are padded to a power of two
+        // with exhausted sources.
+        auto const leaves = losers_.size();
+        std::vector<std::uint32_t> winners(2 * leaves);
+        std::iota(winners.begin() + static_cast<std::ptrdiff_t>(leaves), winners.end(), std::uint32_t{0});
+        for (auto node = leaves - 1; node != 0; --node) {
+            auto const left = winners[2 * node];
+            auto const right = winners[2 * node + 1];
+            auto const right_wins = beats(right, left);
+            winners[node] = right_wins ? right : left;
+            losers_[node] = right_wins ? left : right;
+        }
+        losers_[0] = winners[1];
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return exhausted_[losers_[0]]; }
+
+    /**
+     * @return the smallest element of all sources, may only be called when not empty()
+     */
+    [[nodiscard]] decltype(auto) front() { return key(losers_[0]); }
+
+    /**
+     * @return the position of the source front() comes from
+     */
+    [[nodiscard]] std::size_t winner() const noexcept { return losers_[0]; }
+
+    /**
+     * Moves past front() and finds the next smallest element. May only be called when not empty().
+     */
+    void advance() {
+        auto winner = losers_[0];
+        sources_[winner].advance();
+        enter(winner);
+        for (auto node = (losers_.size() + winner) / 2; node != 0; node /= 2) {
+            // swapped with a mask, compilers turn a conditional swap back into a branch
+            auto const stored = losers_[node];
+            auto const swap = (stored ^ winner) & (std::uint32_t{0} - static_cast<std::uint32_t>(beats(stored, winner)));
+            losers_[node] = stored ^ swap;
+            winner ^= swap;
+        }
+        losers_[0] = winner;
+    }
+
+private:
+    static constexpr bool caches_keys = std::is_trivially_copyable_v<value_type> && std::default_initializable<value_type> && sizeof(value_type) <= 16;
+
+    // looks at the new front of `source`
+    void enter(std::size_t source) {
+        exhausted_[source] = sources_[source].empty();
+        if constexpr (caches_keys) {
+            if (!exhausted_[source]) {
+                keys_[source] = sources_[source].front();
+            }
+        }
+    }
+
+    [[nodiscard]] decltype(auto) key(std::uint32_t source) {
+        if constexpr (caches_keys) {
+            return static_cast<value_type const&>(keys_[source]);
+        } else {
+            return sources_[source].front();
+        }
+    }
+
+    /**
+     * @return whether source `lhs` goes before source `rhs`, ties go to the one that comes first
+     */
+    [[nodiscard]] bool beats(std::uint32_t lhs, std::uint32_t rhs) {
+        if constexpr (caches_keys) {
+            // the key of the later source goes first, so that it only comes out ahead when strictly less, and the result is flipped back if that is `rhs`.
+            // The later source is picked with a mask, a select between the keys gets compiled into a branch, and bitwise operators rather than && and ||
+            // keep the rest of the match free of jumps as well.
+            auto const lhs_earlier = lhs < rhs;
+            auto const later = lhs ^ ((lhs ^ rhs) & (std::uint32_t{0} - static_cast<std::uint32_t>(lhs_earlier)));
+            auto const later_first = static_cast<bool>(comp_(keys_[later], keys_[later ^ lhs ^ rhs]));
+            bool const lhs_live = !exhausted_[lhs];
+            bool const rhs_exhausted = exhausted_[rhs];
+            bool const lhs_ahead = later_first != lhs_earlier;
+            return lhs_live & (rhs_exhausted | lhs_ahead);
+        } else {
+            if (exhausted_[lhs]) {
+                return false;
+            }
+            if (exhausted_[rhs]) {
+                return true;
+            }
+            return lhs < rhs ? !comp_(key(rhs), key(lhs)) : static_cast<bool>(comp_(key(lhs), key(rhs)));
+        }
+    }
+
+    std::vector<Source> sources_;
+    // losers_[0] is the winner of the whole tournament, losers_[n] the loser of the match at node n
+    std::vector<std::uint32_t> losers_;
+    // indexed by source, including the padding
+    std::vector<std::uint8_t> exhausted_;
+    std::vector<std::conditional_t<caches_keys, value_type, std::uint8_t>> keys_;
+    Compare comp_;
+};
+
+/**
+ * Merges sorted sources into `out` with a loser_tree, stable across the sources
+ * @return the end of the output
+ */
+template <merge_source Source, std::weakly_incrementable Output, typename Compare = std::less<>>
+Output k_way_merge(std::vector<Source> sources, Output out, Compare comp = {}) {
+    loser_tree<Source, Compare> tree{std::move(sources), comp};
+    for (; !tree.empty(); tree.advance()) {
+        *out = tree.front();
+        ++out;
+    }
+    return out;
+}
+
+/**
+ * Merges the sorted ranges [first, second) of `ranges` into `out`, stable across the ranges
+ * @return the end of the output
+ */
+template <std::input_iterator Iterator, std::weakly_incrementable Output, typename Compare = std::less<>>
+Output k_way_merge(std::vector<std::pair<Iterator, Iterator>> const& ranges, Output out, Compare comp = {}) {
+    std::vector<range_source<Iterator>> sources;
+    sources.reserve(ranges.size());
+    for (auto const& [begin, end] : ranges) {
+        sources.emplace_back(begin, end);
+    }
+    return k_way_merge(std::move(sources), std::move(out), comp);
+}
+}  // namespace algo
+#endif  // ALGO_LAND_MERGE_H
@@ -0,0 +1,149 @@
+#ifndef ALGO_LAND_MULTI_QUEUE_H
+#define ALGO_LAND_MULTI_QUEUE_H
+
+#include <priority_queue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+/**
+ * A relaxed concurrent priority queue, the MultiQueue of Rihani, Sanders and Dementiev: `queues_per_thread` times the number of threads priority_queue
+ * shards, each behind its own lock. A push goes to a random shard. A pop looks at two random shards and takes the top of the better one, which keeps what
+ * comes out close to the true top: the expected rank error grows linearly with the number of shards and does not depend on the size. With several shards per
+ * thread two threads rarely want the same lock, so throughput keeps scaling with the thread count where a single locked heap stops at a handful of threads.
+ *
+ * Nothing ever blocks on a lock while holding another: shards are only ever try-locked, a busy shard is simply passed over for another random one.
+ * @tparam Compare as for priority_queue, pops return roughly the greatest elements first
+ */
+template <std::movable T, typename Compare = std::less<>>
+class multi_queue {
+public:
+    using value_type = T;
+
+    /**
+     * @param thread_count how many threads will use the queue
+     * @param queues_per_thread the relaxation, more shards mean less contention and a bigger rank error, 2 is the usual choice
+     */
+    explicit multi_queue(std::size_t thread_count = std::max(std::thread::hardware_concurrency(), 1U), std::size_t queues_per_thread = 2,
+                         Compare comp = {})
+        : comp_{comp} {
+        auto const shard_count = std::max<std::size_t>(thread_count * queues_per_thread, 1);
+        shards_.reserve(shard_count);
+        for (std::size_t i = 0; i != shard_count; ++i) {
+            shards_.push_back(std::make_unique<shard>(comp));
+        }
+    }
+
+    multi_queue(multi_queue const&) = delete;
+    multi_queue& operator=(multi_queue const&) = delete;
+
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void insert(U&& u) {
+        while (true) {
+            auto& target = *shards_[random_shard()];
+            std::unique_lock lock{target.mutex_, std::try_to_lock};
+            if (lock.owns_lock()) {
+                target.heap_.insert(std::forward<U>(u));
+                target.size_.store(target.heap_.size(), std::memory_order_relaxed);
+                size_.fetch_add(1, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Takes the better top of two random shards
+     * @return one of the greatest elements, nullopt when the queue is empty
+     */
+    std::optional<T> try_pop() {
+        // after this many attempts every shard is tried in turn, so a lone element in a queue of many shards is found in bounded time
+        constexpr std::size_t random_attempts = 16;
+        for (std::size_t attempt = 0; size_.load(std::memory_order_acquire) != 0; ++attempt) {
+            if (attempt < random_attempts) {
+                if (auto popped = pop_better_of(random_shard(), random_shard())) {
+                    return popped;
+                }
+            } else {
+                for (std::size_t i = 0; i != shards_.size(); ++i) {
+                    if (auto popped = pop_better_of(i, i)) {
+                        return popped;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @return the number of elements, exact only while no other thread uses the queue
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_.load(std::memory_order_acquire); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] std::size_t shard_count() const noexcept { return shards_.size(); }
+
+private:
+    // a cache line each, so that the locks of neighbouring shards do not share one
+    struct alignas(64) shard {
+        explicit shard(Compare comp) : heap_{comp} {}
+
+        std::mutex mutex_;
+        priority_queue<T, Compare> heap_;
+        // read without the lock to skip empty shards
+        std::atomic<std::size_t> size_ = 0;
+    };
+
+    std::optional<T> pop_better_of(std::size_t first, std::size_t second) {
+        auto& lhs = *shards_[first];
+        auto& rhs = *shards_[second];
+        if (lhs.size_.load(std::memory_order_relaxed) == 0 && rhs.size_.load(std::memory_order_relaxed) == 0) {
+            return std::nullopt;
+        }
+
+        std::unique_lock lhs_lock{lhs.mutex_, std::try_to_lock};
+        std::unique_lock<std::mutex> rhs_lock;
+        if (first != second) {
+            rhs_lock = std::unique_lock{rhs.mutex_, std::try_to_lock};
+        }
+        auto const lhs_ready = lhs_lock.owns_lock() && !lhs.heap_.empty();
+        auto const rhs_ready = rhs_lock.owns_lock() && !rhs.heap_.empty();
+        if (!lhs_ready && !rhs_ready) {
+            return std::nullopt;
+        }
+
+        auto& better = !rhs_ready || (lhs_ready && !comp_(lhs.heap_.top(), rhs.heap_.top())) ? lhs : rhs;
+        auto popped = better.heap_.pop();
+        better.size_.store(better.heap_.size(), std::memory_order_relaxed);
+        size_.fetch_sub(1, std::memory_order_release);
+        return popped;
+    }
+
+    [[nodiscard]] std::size_t random_shard() noexcept {
+        // xorshift, one state per thread, seeded from the thread's address so that threads do not walk the same sequence
+        thread_local std::uint64_t state = reinterpret_cast<std::uintptr_t>(&state) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<std::size_t>((state >> 32) * shards_.size() >> 32);
+    }
+
+    std::vector<std::unique_ptr<shard>> shards_;
+    std::atomic<std::size_t> size_ = 0;
+    Compare comp_;
+};
+}  // namespace algo
+#endif  // ALGO_LAND_MULTI_QUEUE_H
@@ -0,0 +1,406 @@
+#ifndef ALGO_LAND_PAIRING_HEAP_H
+#define ALGO_LAND_PAIRING_HEAP_H
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo {
+namespace pairing_details {
+/**
+ * Hands out node sized slots carved from chunks that are only freed with the pool, with a free list for slots given back. A pool can take over all the
+ * chunks of another in O(1), so that the nodes of two heaps can be melded without copying or reallocating a single one.
+ */
+template <typename Node>
+class node_pool {
+public:
+    node_pool() noexcept = default;
+    node_pool(node_pool const&) = delete;
+    node_pool& operator=(node_pool const&) = delete;
+
+    node_pool(node_pool&& other) noexcept
+        : chunks_{std::exchange(other.chunks_, nullptr)},
+          last_chunk_{std::exchange(other.last_chunk_, nullptr)},
+          free_{std::exchange(other.free_, nullptr)},
+          last_free_{std::exchange(other.last_free_, nullptr)},
+          next_{std::exchange(other.next_, nullptr)},
+          end_{std::exchange(other.end_, nullptr)},
+          chunk_capacity_{std::exchange(other.chunk_capacity_, first_chunk_capacity)} {}
+
+    node_pool& operator=(node_pool&& other) noexcept {
+        if (this != &other) {
+            release();
+            chunks_ = std::exchange(other.chunks_, nullptr);
+            last_chunk_ = std::exchange(other.last_chunk_, nullptr);
+            free_ = std::exchange(other.free_, nullptr);
+            last_free_ = std::exchange(other.last_free_, nullptr);
+            next_ = std::exchange(other.next_, nullptr);
+            end_ = std::exchange(other.end_, nullptr);
+            chunk_capacity_ = std::exchange(other.chunk_capacity_, first_chunk_capacity);
+        }
+        return *this;
+    }
+
+    ~node_pool() { release(); }
+
+    /**
+     * @return uninitialised storage for one Node
+     */
+    [[nodiscard]] void* allocate() {
+        if (free_) {
+            auto* slot = free_;
+            free_ = slot->next_;
+            if (!free_) {
+                last_free_ = nullptr;
+            }
+            return slot;
+        }
+        if (next_ == end_) {
+            add_chunk();
+        }
+        return next_++;
+    }
+
+    void deallocate(void* storage) noexcept {
+        auto* slot = ::new (storage) free_slot{free_};
+        if (!free_) {
+            last_free_ = slot;
+        }
+        free_ = slot;
+    }
+
+    /**
+     * Takes over the chunks and free slots of `other`, whose nodes stay where they are. What is left of the chunk `other` was carving from is given up,
+     * at most one chunk per splice.
+     */
+    void splice(node_pool& other) noexcept {
+        if (other.chunks_) {
+            other.last_chunk_->next_ = chunks_;
+            chunks_ = std::exchange(other.chunks_, nullptr);
+            if (!last_chunk_) {
+                last_chunk_ = other.last_chunk_;
+            }
+            other.last_chunk_ = nullptr;
+        }
+        if (other.free_) {
+            other.last_free_->next_ = free_;
+            free_ = std::exchange(other.free_, nullptr);
+            if (!last_free_) {
+                last_free_ = other.last_free_;
+            }
+            other.last_free_ = nullptr;
+        }
+        other.next_ = other.end_ = nullptr;
+    }
+
+private:
+    union slot_storage {
+        alignas(Node) std::byte bytes_[sizeof(Node)];
+    };
+
+    struct free_slot {
+        free_slot* next_;
+    };
+    static_assert(sizeof(slot_storage) >= sizeof(free_slot));
+
+    struct chunk {
+        chunk* next_;
+    };
+
+    // chunks grow geometrically up to a few hundred KiB, so small heaps stay small and big ones allocate rarely
+    static constexpr std::size_t first_chunk_capacity = 32;
+    static constexpr std::size_t max_chunk_capacity = 8192;
+    static constexpr std::size_t slots_offset = (sizeof(chunk) + alignof(slot_storage) - 1) / alignof(slot_storage) * alignof(slot_storage);
+    static constexpr std::align_val_t chunk_alignment{std::max(alignof(chunk), alignof(slot_storage))};
+
+    void add_chunk() {
+        auto* memory = static_cast<std::byte*>(::operator new(slots_offset + chunk_capacity_ * sizeof(slot_storage), chunk_alignment));
+        auto* added = ::new (memory) chunk{chunks_};
+        if (!chunks_) {
+            last_chunk_ = added;
+        }
+        chunks_ = added;
+        next_ = reinterpret_cast<slot_storage*>(memory + slots_offset);
+        end_ = next_ + chunk_capacity_;
+        chunk_capacity_ = std::min(2 * chunk_capacity_, max_chunk_capacity);
+    }
+
+    void release() noexcept {
+        while (chunks_) {
+            ::operator delete(std::exchange(chunks_, chunks_->next_), chunk_alignment);
+        }
+        last_chunk_ = nullptr;
+        free_ = last_free_ = nullptr;
+        next_ = end_ = nullptr;
+    }
+
+    chunk* chunks_ = nullptr;
+    chunk* last_chunk_ = nullptr;
+    free_slot* free_ = nullptr;
+    free_slot* last_free_ = nullptr;
+    slot_storage* next_ = nullptr;
+    slot_storage* end_ = nullptr;
+    std::size_t chunk_capacity_ = first_chunk_capacity;
+};
+}  // namespace pairing_details
+
+/**
+ * A pairing heap: a tree of any shape in which every node is no greater than its children, linked as first child and next sibling. Insert and meld link
+ * two roots, O(1); decrease_key cuts the node's subtree out and links it with the root, O(1) as well in practice; pop links the children of the root in
+ * pairs, left to right, then the pairs right to left, amortised O(log n). Unlike priority_queue, a whole heap can be merged into another without moving a
+ * single element.
+ *
+ * Nodes come from a pool owned by the heap and pass with meld to the heap that absorbs them, so handles stay valid across a meld.
+ *
+ * As in indexed_priority_queue, the top is the least element under `Compare`, so decrease_key moves an element towards the top.
+ */
+template <std::movable T, typename Compare = std::less<>>
+class pairing_heap {
+    struct node {
+        T value_;
+        node* child_ = nullptr;
+        node* next_ = nullptr;
+        // the left sibling, or the parent of a first child
+        node* prev_ = nullptr;
+    };
+
+public:
+    using value_type = T;
+
+    /**
+     * Refers to an element from its insert until it is popped, also after the heap it lives in is melded into another
+     */
+    class handle {
+    public:
+        handle() noexcept = default;
+        friend bool operator==(handle, handle) noexcept = default;
+
+    private:
+        friend pairing_heap;
+        explicit handle(node* target) noexcept : node_{target} {}
+        node* node_ = nullptr;
+    };
+
+    pairing_heap() = default;
+    explicit pairing_heap(Compare comp) : comp_{comp} {}
+
+    pairing_heap(pairing_heap const&) = delete;
+    pairing_heap& operator=(pairing_heap const&) = delete;
+
+    pairing_heap(pairing_heap&& other) noexcept
+        : pool_{std::move(other.pool_)}, root_{std::exchange(other.root_, nullptr)}, size_{std::exchange(other.size_, 0)}, comp_{other.comp_} {}
+
+    pairing_heap& operator=(pairing_heap&& other) noexcept {
+        if (this != &other) {
+            destroy_nodes();
+            pool_ = std::move(other.pool_);
+            root_ = std::exchange(other.root_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            comp_ = other.comp_;
+        }
+        return *this;
+    }
+
+    ~pairing_heap() { destroy_nodes(); }
+
+    [[nodiscard]] bool empty() const noexcept { return root_ == nullptr; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    template <typename U>
+    requires std::convertible_to<U, T>
+    handle insert(U&& u) {
+        auto* storage = pool_.allocate();
+        node* inserted;
+        try {
+            inserted = ::new (storage) node{T(std::forward<U>(u))};
+        } catch (...) {
+            pool_.deallocate(storage);
+            throw;
+        }
+        root_ = root_ ? link(root_, inserted) : inserted;
+        ++size_;
+        return handle{inserted};
+    }
+
+    /**
+     * @return the least element, may only be called when not empty()
+     */
+    [[nodiscard]] T const& top() const noexcept { return root_->value_; }
+    [[nodiscard]] handle top_handle() const noexcept { return handle{root_}; }
+
+    /**
+     * @return the element `target` refers to, which must still be in the heap
+     */
+    [[nodiscard]] T const& value(handle target) const noexcept { return target.node_->value_; }
+
+    /**
+     * @throws std::out_of_range when empty
+     */
+    T pop() {
+        if (empty()) {
+            throw std::out_of_range{"The heap is empty!"};
+        }
+        auto* popped = std::exchange(root_, merge_pairs(root_->child_));
+        auto top_element = std::move(popped->value_);
+        popped->~node();
+        pool_.deallocate(popped);
+        --size_;
+        return top_element;
+    }
+
+    /**
+     * Lowers the element `target` refers to, which must still be in the heap
+     * @throws std::invalid_argument when `value` is greater than the current element
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void decrease_key(handle target, U&& value) {
+        auto* const decreased = target.node_;
+        if (comp_(decreased->value_, value)) {
+            throw std::invalid_argument{"The new key is greater than the current one!"};
+        }
+        decreased->value_ = std::forward<U>(value);
+        if (decreased == root_) {
+            return;
+        }
+        // cut the subtree out of its sibling list and link it with the root
+        if (decreased->prev_->child_ == decreased) {
+            decreased->prev_->child_ = decreased->next_;
+        } else {
+            decreased->prev_->next_ = decreased->next_;
+        }
+        if (decreased->next_) {
+            decreased->next_->prev_ = decreased->prev_;
+        }
+        decreased->next_ = nullptr;
+        root_ = link(root_, decreased);
+    }
+
+    /**
+     * Moves every element of `other` into this heap in O(1), leaving `other` empty. Handles to elements of `other` now refer to elements of this heap.
+     * Both heaps are expected to order alike.
+     */
+    void meld(pairing_heap& other) noexcept {
+        if (this == &other || other.empty()) {
+            return;
+        }
+        pool_.splice(other.pool_);
+        auto* const other_root = std::exchange(other.root_, nullptr);
+        root_ = root_ ? link(root_, other_root) : other_root;
+        size_ += std::exchange(other.size_, 0);
+    }
+
+    [[nodiscard]] bool validate() const {
+        if (!root_) {
+            return size_ == 0;
+        }
+        if (root_->next_ || root_->prev_) {
+            return false;
+        }
+        // an explicit stack, n inserts in descending order leave a chain n nodes deep
+        std::size_t count = 0;
+        std::vector<node const*> pending{root_};
+        while (!pending.empty()) {
+            auto const* const parent = pending.back();
+            pending.pop_back();
+            ++count;
+            node const* previous = parent;
+            for (auto const* child = parent->child_; child; child = child->next_) {
+                if (child->prev_ != previous || comp_(child->value_, parent->value_)) {
+                    return false;
+                }
+                pending.push_back(child);
+                previous = child;
+            }
+        }
+        return count == size_;
+    }
+
+private:
+    /**
+     * Makes the greater of two roots the first child of the other
+     * @return the new root, whose next_ and prev_ are left for the caller
+     */
+    node* link(node* first, node* second) noexcept {
+        if (comp_(second->value_, first->value_)) {
+            std::swap(first, second);
+        }
+        second->next_ = first->child_;
+        if (first->child_) {
+            first->child_->prev_ = second;
+        }
+        second->prev_ = first;
+        first->child_ = second;
+        first->prev_ = nullptr;
+        return first;
+    }
+
+    /**
+     * The two pass merge of a sibling list: link pairs left to right, then fold the pairs into one tree right to left. The first pass chains the pairs
+     * through prev_, so that the second can walk them backwards without recursion.
+     */
+    node* merge_pairs(node* first) noexcept {
+        if (!first) {
+            return nullptr;
+        }
+        node* last_pair = nullptr;
+        while (first) {
+            auto* const lhs = first;
+            auto* const rhs = lhs->next_;
+            first = rhs ? rhs->next_ : nullptr;
+            lhs->next_ = nullptr;
+            node* pair = lhs;
+            if (rhs) {
+                rhs->next_ = nullptr;
+                pair = link(lhs, rhs);
+            }
+            pair->prev_ = last_pair;
+            last_pair = pair;
+        }
+        auto* merged = last_pair;
+        for (auto* pair = merged->prev_; pair;) {
+            auto* const previous = pair->prev_;
+            merged = link(pair, merged);
+            pair = previous;
+        }
+        merged->prev_ = nullptr;
+        return merged;
+    }
+
+    /**
+     * Destroys every element without recursion: seen as a binary tree with the first child on the left and the next sibling on the right, a node is
+     * destroyed once its left is empty, otherwise rotated right, which keeps the work linear
+     */
+    void destroy_nodes() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (auto* current = root_; current;) {
+                if (auto* const child = current->child_) {
+                    current->child_ = child->next_;
+                    child->next_ = current;
+                    current = child;
+                } else {
+                    auto* const next = current->next_;
+                    current->~node();
+                    current = next;
+                }
+            }
+        }
+        // the pool frees the memory
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    pairing_details::node_pool<node> pool_;
+    node* root_ = nullptr;
+    std::size_t size_ = 0;
+    [[no_unique_address]] Compare comp_;
+};
+}  // namespace algo
+#endif  // ALGO_LAND_PAIRING_HEAP_H
@@ -5,30 +5,147 @@
 #ifndef ALGO_LAND_PRIORITY_QUEUE_H
 #define ALGO_LAND_PRIORITY_QUEUE_H
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <new>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace algo {
 
-template <typename T, typename Compare = std::less<>>
+namespace pq_details {
+/**
+ * Allocates so that the element at index 1, rather than the one at index 0, starts at a multiple of `Alignment`. The children of a heap node start at
+ * Arity * pos + 1, so with the children of the root aligned, the children of every node are.
+ */
+template <typename T, std::size_t Alignment>
+struct child_aligned_allocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = child_aligned_allocator<U, Alignment>;
+    };
+
+    child_aligned_allocator() noexcept = default;
+    template <typename U>
+    child_aligned_allocator(child_aligned_allocator<U, Alignment> const&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        auto* memory = static_cast<std::byte*>(::operator new(offset + count * sizeof(T), std::align_val_t{Alignment}));
+        return reinterpret_cast<T*>(memory + offset);
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept { ::operator delete(reinterpret_cast<std::byte*>(pointer) - offset, std::align_val_t{Alignment}); }
+
+    template <typename U>
+    friend bool operator==(child_aligned_allocator const&, child_aligned_allocator<U, Alignment> const&) noexcept {
+        return true;
+    }
+
+private:
+    static constexpr std::size_t offset = (Alignment - sizeof(T) % Alignment) % Alignment;
+};
+
+inline constexpr std::size_t cache_line = 64;
+
+/**
+ * Child groups of wider heaps whose size is a power of two are aligned to it, or to a cache line if they are bigger, so that no group straddles more lines
+ * than it has to. Anything else, the default binary heap included, is left to the default allocator.
+ */
+template <typename T, std::size_t Arity>
+using heap_allocator = std::conditional_t<(Arity > 2) && std::has_single_bit(Arity * sizeof(T)) && alignof(T) <= cache_line,
+                                          child_aligned_allocator<T, std::min(Arity * sizeof(T), cache_line)>, std::allocator<T>>;
+}  // namespace pq_details
+
+/**
+ * A d-ary heap: every node has `Arity` children, stored next to each other. A wider heap is shallower, so a push moves an element up fewer levels, and a
+ * pop moves the hole down fewer levels, finding the best child of each with a single scan of its group. With 4 or 8 small elements the group fills at most one
+ * cache line and is allocated to start on one, so a level of a pop touches one line, at the price of more comparisons per level. Which arity is fastest
+ * depends on the element size and the workload, bench/priority_queue_bench.cpp compares them.
+ * @tparam Compare the top is the element that no other element is greater than, std::less<> gives a max heap, unlike indexed_priority_queue
+ * @tparam Arity the number of children per node, at least 2
+ */
+template <typename T, typename Compare = std::less<>, std::size_t Arity = 2>
 class priority_queue {
+    static_assert(Arity >= 2, "a heap needs at least two children per node");
+
 public:
     using value_type = T;
 
+    priority_queue() = default;
+    explicit priority_queue(Compare comp) : comp_{comp} {}
+
+    /**
+     * Builds the heap from [begin, end) in O(n), see insert_range
+     */
+    template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+    requires std::convertible_to<std::iter_reference_t<Iterator>, T>
+    priority_queue(Iterator begin, Sentinel end, Compare comp = {}) : comp_{comp} {
+        insert_range(std::ranges::subrange{std::move(begin), std::move(end)});
+    }
+
     template <typename U>
     requires std::convertible_to<U, T>
     void insert(U&& u) noexcept {
-        using std::is_heap, std::begin, std::end, std::forward;
+        using std::forward;
 
         arr_.push_back(forward<U>(u));
         swim(arr_.size() - 1);
+    }
+
+    /**
+     * Inserts every element of `range`. When the new elements are many compared to the heap, the whole array is heapified bottom up, Floyd's way, in O(n)
+     * rather than the O(n log n) of inserting one at a time: half of all nodes are leaves that need no work, and a node h levels up sinks at most h levels.
+     * Otherwise the new elements swim up one at a time.
+     */
+    template <std::ranges::input_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void insert_range(Range&& range) {
+        auto const old_size = arr_.size();
+        if constexpr (std::ranges::sized_range<Range>) {
+            arr_.reserve(old_size + std::ranges::size(range));
+        }
+        if constexpr (std::ranges::common_range<Range>) {
+            arr_.insert(arr_.end(), std::ranges::begin(range), std::ranges::end(range));
+        } else {
+            for (auto&& element : range) {
+                arr_.push_back(std::forward<decltype(element)>(element));
+            }
+        }
+
+        auto const added = arr_.size() - old_size;
+        // swimming costs up to log n per element, heapifying a constant per element of the whole heap
+        if (added * static_cast<std::size_t>(std::bit_width(arr_.size())) > arr_.size()) {
+            heapify();
+        } else {
+            for (auto pos = old_size; pos != arr_.size(); ++pos) {
+                swim(pos);
+            }
+        }
         assert(validate());
     }
 
     [[nodiscard]] bool empty() const noexcept { return arr_.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return arr_.size(); }
+    void reserve(std::size_t capacity) { arr_.reserve(capacity); }
+
+    /**
+     * The elements in heap order, the top first
+     */
+    [[nodiscard]] std::span<T const> elements() const noexcept { return arr_; }
 
     T pop() {
         using std::swap, std::move;
@@ -43,14 +160,56 @@ public:
             if (!arr_.empty()) {
                 sink(0);
             }
-            assert(validate());
             return top_element;
         } else {
-            assert(validate());
             throw std::out_of_range{"The heap is empty!"};
         }
     }
 
+    /**
+     * Pops up to `count` elements, greatest first, into `out`. Taking all or most of the heap selects them at the back of the array instead, sorts only
+     * those, moves them out and heapifies what is left, all passes that touch the array sequentially where every pop walks a path from the root down to a leaf.
+     * @return the end of the output
+     */
+    template <std::weakly_incrementable Output>
+    requires std::indirectly_writable<Output, T&&>
+    Output pop_n(std::size_t count, Output out) {
+        using std::move;
+
+        count = std::min(count, arr_.size());
+        if (2 * count >= arr_.size()) {
+            // taken from the back, so that nothing that stays has to move up to close the gap
+            auto const first_popped = arr_.end() - static_cast<std::ptrdiff_t>(count);
+            std::nth_element(arr_.begin(), first_popped, arr_.end(), [this](T const& lhs, T const& rhs) { return comp_(lhs, rhs); });
+            std::sort(first_popped, arr_.end(), [this](T const& lhs, T const& rhs) { return comp_(rhs, lhs); });
+            out = std::move(first_popped, arr_.end(), move(out));
+            arr_.erase(first_popped, arr_.end());
+            heapify();
+        } else {
+            for (std::size_t popped = 0; popped != count; ++popped) {
+                *out = move(arr_.front());
+                ++out;
+                arr_.front() = move(arr_.back());
+                arr_.pop_back();
+                if (!arr_.empty()) {
+                    sink(0);
+                }
+            }
+        }
+        assert(validate());
+        return out;
+    }
+
+    /**
+     * Pops the top and inserts `u` in a single sink, may only be called when not empty()
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void replace_top(U&& u) {
+        arr_.front() = std::forward<U>(u);
+        sink(0);
+    }
+
     /**
      * Access the top element. The reference is const so that the caller can't destroy the weak ordering invariance.
      * @return top element
@@ -64,48 +223,598 @@ public:
         std::cout << '\n';
     }
 
-    [[nodiscard]] bool validate() const { return std::is_heap(std::begin(arr_), std::begin(arr_), comp_); }
+    [[nodiscard]] bool validate() const {
+        for (std::size_t pos = 1; pos < arr_.size(); ++pos) {
+            if (comp_(arr_[parent(pos)], arr_[pos])) {
+                return false;
+            }
+        }
+        return true;
+    }
 
 private:
-    [[nodiscard]] constexpr std::size_t left_child(std::size_t pos) const noexcept { return 2 * pos + 1; }
-    [[nodiscard]] constexpr std::size_t right_child(std::size_t pos) const noexcept { return 2 * pos + 2; }
-    [[nodiscard]] constexpr std::size_t parent(std::size_t pos) const noexcept { return (pos - 1) / 2; }
-
-    void swim(std::size_t pos) noexcept {
-        while (pos != 0 && comp_(arr_[parent(pos)], arr_[pos])) {
-            using std::swap;
-            swap(arr_[parent(pos)], arr_[pos]);
+    [[nodiscard]] static constexpr std::size_t first_child(std::size_t pos) noexcept { return Arity * pos + 1; }
+    [[nodiscard]] static constexpr std::size_t parent(std::size_t pos) noexcept { return (pos - 1) / Arity; }
+
+    // both move a hole rather than swapping, every level costs one move instead of three
+    // swims no further up than `top`
+    void swim(std::size_t pos, std::size_t top = 0) noexcept {
+        using std::move;
+
+        auto value = move(arr_[pos]);
+        while (pos != top && comp_(arr_[parent(pos)], value)) {
+            arr_[pos] = move(arr_[parent(pos)]);
             pos = parent(pos);
         }
-        assert(validate());
+        arr_[pos] = move(value);
     }
 
+    /**
+     * The element at `pos` is most likely the one that came from the back, which belongs near the bottom again. So the hole goes all the way down along the
+     * greatest children without comparing them against it, and the element swims up from the leaf the hole ends at, which is usually only a level or so.
+     */
     void sink(std::size_t pos) noexcept {
-        // stop when left_ child is the last element
-        while (left_child(pos) < arr_.size()) {
-            std::size_t const next_child = [pos, this]() {
-                auto const left_child_pos = left_child(pos);
-                auto const right_child_pos = right_child(pos);
-
-                // there are two conditions that prevent us from selecting the right child as the next one to consider
-                // 1. there are no right child, i.e. the current child is already the last one in the arr
-                // 2. the right child is not the correct choice (for instance the right child is smaller in a max heap)
-                return (right_child_pos < arr_.size() && comp_(arr_[left_child_pos], arr_[right_child_pos])) ? right_child_pos : left_child_pos;
-            }();
-
-            // this means we have fix the invariance
-            if (!comp_(arr_[pos], arr_[next_child])) {
-                break;
+        using std::move;
+
+        auto const size = arr_.size();
+        auto const top = pos;
+        auto value = move(arr_[pos]);
+        while (first_child(pos) < size) {
+            prefetch_grandchildren(first_child(pos), size);
+            auto const best = greatest_child(first_child(pos), size);
+            arr_[pos] = move(arr_[best]);
+            pos = best;
+        }
+        arr_[pos] = move(value);
+        swim(pos, top);
+    }
+
+    // every parent sinks into the heaps below it once they are built
+    void heapify() noexcept {
+        if (arr_.size() >= 2) {
+            heapify(0);
+        }
+    }
+
+    /**
+     * Builds the subtrees of `pos` depth first before sinking it, rather than going through all the parents from the last one back, level by level. Either
+     * way each node sinks once, but depth first a subtree is done while it is still in the cache, where level by level each level of a big heap is brought in
+     * again for every level above it.
+     */
+    void heapify(std::size_t pos) noexcept {
+        auto const first = first_child(pos);
+        if (first >= arr_.size()) {
+            return;
+        }
+        // children without children of their own are heaps already, which is half of all nodes
+        if (first_child(first) < arr_.size()) {
+            for (auto child = first; child != std::min(first + Arity, arr_.size()); ++child) {
+                heapify(child);
+            }
+        }
+        sink(pos);
+    }
+
+    /**
+     * The grandchildren of the group at `first` are the Arity * Arity elements from the first child of its first element on, and whichever child wins the
+     * scan of the group, its children are among them. Asking for all of them before the scan keeps the next level coming while this one is searched.
+     */
+    void prefetch_grandchildren([[maybe_unused]] std::size_t first, [[maybe_unused]] std::size_t size) const noexcept {
+#if defined(__GNUC__)
+        auto const grandchildren = first_child(first);
+        if (grandchildren >= size) {
+            return;
+        }
+        auto const* begin = reinterpret_cast<char const*>(arr_.data() + grandchildren);
+        auto const* end = reinterpret_cast<char const*>(arr_.data() + std::min(grandchildren + Arity * Arity, size));
+        for (auto const* line = begin; line < end; line += pq_details::cache_line) {
+            __builtin_prefetch(line);
+        }
+#endif
+    }
+
+    /**
+     * A single scan of the group, full groups, all but the last one, are unrolled. The select is left to be a branch on purpose: speculating down the predicted
+     * path loads the levels below before the comparisons resolve, which is worth more than the mispredictions cost. Forcing conditional
+     * moves made pops 1.5x faster while the heap is cached, and 2-3x slower once it is not.
+     */
+    [[nodiscard]] std::size_t greatest_child(std::size_t first, std::size_t size) const noexcept {
+        auto best = first;
+        if (first + Arity <= size) {
+            for (std::size_t child = first + 1; child != first + Arity; ++child) {
+                best = comp_(arr_[best], arr_[child]) ? child : best;
+            }
+        } else {
+            for (auto child = first + 1; child < size; ++child) {
+                best = comp_(arr_[best], arr_[child]) ? child : best;
+            }
+        }
+        return best;
+    }
+
+    std::vector<T, pq_details::heap_allocator<T, Arity>> arr_;
+    Compare comp_;
+};
+
+/**
+ * A MIN heap of keys that each belong to a handle, an index in [0, n), in the manner of Sedgewick's IndexMinPQ. Note that this is the opposite of
+ * priority_queue: with the same `Compare`, top() and pop() give the least key here and the greatest one there. decrease_key thus moves a handle towards the
+ * top, which is what shortest path searches want.
+ *
+ * A position map from handles to heap slots lets the key of any queued handle be changed or removed in O(log n), so there is no need to push a duplicate and
+ * skip the stale copies later: the heap only ever holds one entry per live handle. Handles are small integers such as vertex ids; the position map grows to
+ * the largest one used.
+ * @tparam Compare the top is the element that is not greater than any other, std::less<> gives a min heap
+ * @tparam Arity the number of children per node, see priority_queue
+ */
+template <typename T, typename Compare = std::less<>, std::size_t Arity = 2>
+class indexed_priority_queue {
+    static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+public:
+    using value_type = T;
+    using handle_type = std::size_t;
+
+    [[nodiscard]] bool empty() const noexcept { return heap_.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return heap_.size(); }
+    [[nodiscard]] bool contains(handle_type handle) const noexcept { return handle < positions_.size() && positions_[handle] != absent; }
+
+    /**
+     * @throws std::invalid_argument when `handle` is already queued
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void insert(handle_type handle, U&& key) {
+        if (contains(handle)) {
+            throw std::invalid_argument{"The handle is already in the heap!"};
+        }
+        if (handle >= positions_.size()) {
+            positions_.resize(handle + 1, absent);
+        }
+        heap_.push_back(entry{std::forward<U>(key), handle});
+        swim(heap_.size() - 1);
+        assert(validate());
+    }
+
+    /**
+     * @return the least key, may only be called when not empty()
+     */
+    [[nodiscard]] T const& top() const noexcept { return heap_.front().key_; }
+    [[nodiscard]] handle_type top_handle() const noexcept { return heap_.front().handle_; }
+
+    /**
+     * @throws std::out_of_range when `handle` is not queued
+     */
+    [[nodiscard]] T const& key(handle_type handle) const { return heap_[position(handle)].key_; }
+
+    /**
+     * Removes the least key
+     * @return its handle and the key
+     * @throws std::out_of_range when empty
+     */
+    std::pair<handle_type, T> pop() {
+        if (empty()) {
+            throw std::out_of_range{"The heap is empty!"};
+        }
+        auto top_entry = std::move(heap_.front());
+        remove_at(0);
+        return {top_entry.handle_, std::move(top_entry.key_)};
+    }
+
+    /**
+     * Changes the key of `handle` in either direction
+     * @throws std::out_of_range when `handle` is not queued
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void update(handle_type handle, U&& key) {
+        auto const pos = position(handle);
+        auto const towards_top = comp_(key, heap_[pos].key_);
+        heap_[pos].key_ = std::forward<U>(key);
+        towards_top ? swim(pos) : sink(pos);
+        assert(validate());
+    }
+
+    /**
+     * Lowers the key of `handle`, moving it towards the top
+     * @throws std::out_of_range when `handle` is not queued
+     * @throws std::invalid_argument when `key` is greater than the current key
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void decrease_key(handle_type handle, U&& key) {
+        auto const pos = position(handle);
+        if (comp_(heap_[pos].key_, key)) {
+            throw std::invalid_argument{"The new key is greater than the current one!"};
+        }
+        heap_[pos].key_ = std::forward<U>(key);
+        swim(pos);
+        assert(validate());
+    }
+
+    /**
+     * Raises the key of `handle`, moving it away from the top
+     * @throws std::out_of_range when `handle` is not queued
+     * @throws std::invalid_argument when `key` is less than the current key
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void increase_key(handle_type handle, U&& key) {
+        auto const pos = position(handle);
+        if (comp_(key, heap_[pos].key_)) {
+            throw std::invalid_argument{"The new key is less than the current one!"};
+        }
+        heap_[pos].key_ = std::forward<U>(key);
+        sink(pos);
+        assert(validate());
+    }
+
+    /**
+     * @throws std::out_of_range when `handle` is not queued
+     */
+    void erase(handle_type handle) { remove_at(position(handle)); }
+
+    [[nodiscard]] bool validate() const {
+        for (std::size_t pos = 0; pos < heap_.size(); ++pos) {
+            if (positions_[heap_[pos].handle_] != pos || (pos != 0 && comp_(heap_[pos].key_, heap_[parent(pos)].key_))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    // the key lives in the heap rather than behind the handle, so sifting compares what it has already loaded
+    struct entry {
+        T key_;
+        handle_type handle_;
+    };
+
+    static constexpr std::size_t absent = static_cast<std::size_t>(-1);
+
+    [[nodiscard]] static constexpr std::size_t first_child(std::size_t pos) noexcept { return Arity * pos + 1; }
+    [[nodiscard]] static constexpr std::size_t parent(std::size_t pos) noexcept { return (pos - 1) / Arity; }
+
+    [[nodiscard]] std::size_t position(handle_type handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range{"The handle is not in the heap!"};
+        }
+        return positions_[handle];
+    }
+
+    // fills the slot at `pos` with the last entry and restores the heap around it
+    void remove_at(std::size_t pos) {
+        positions_[heap_[pos].handle_] = absent;
+        if (pos + 1 != heap_.size()) {
+            heap_[pos] = std::move(heap_.back());
+            heap_.pop_back();
+            // the last entry may belong above or below the slot it takes over
+            if (pos != 0 && comp_(heap_[pos].key_, heap_[parent(pos)].key_)) {
+                swim(pos);
             } else {
-                using std::swap;
-                swap(arr_[pos], arr_[next_child]);
-                pos = next_child;
+                sink(pos);
+            }
+        } else {
+            heap_.pop_back();
+        }
+        assert(validate());
+    }
+
+    // both move a hole like priority_queue, placing every entry they move in the position map
+    void place(std::size_t pos, entry&& moved) {
+        positions_[moved.handle_] = pos;
+        heap_[pos] = std::move(moved);
+    }
+
+    void swim(std::size_t pos) {
+        auto moving = std::move(heap_[pos]);
+        while (pos != 0 && comp_(moving.key_, heap_[parent(pos)].key_)) {
+            place(pos, std::move(heap_[parent(pos)]));
+            pos = parent(pos);
+        }
+        place(pos, std::move(moving));
+    }
+
+    void sink(std::size_t pos) {
+        auto const size = heap_.size();
+        auto moving = std::move(heap_[pos]);
+        while (first_child(pos) < size) {
+            auto const first = first_child(pos);
+            auto const last = std::min(first + Arity, size);
+            auto best = first;
+            for (auto child = first + 1; child < last; ++child) {
+                best = comp_(heap_[child].key_, heap_[best].key_) ? child : best;
+            }
+            if (!comp_(heap_[best].key_, moving.key_)) {
+                break;
             }
+            place(pos, std::move(heap_[best]));
+            pos = best;
+        }
+        place(pos, std::move(moving));
+    }
+
+    std::vector<entry> heap_;
+    // the heap slot of every handle, absent for handles that are not queued
+    std::vector<std::size_t> positions_;
+    Compare comp_;
+};
+
+/**
+ * A monotone priority queue of integer keys: the top is the least key, and no key may be inserted that is less than the last one popped, which is the case
+ * for the clock of an event simulation and for the distances popped by Dijkstra. An element is kept in the bucket numbered by the highest bit in which its
+ * key differs from the last popped key. When the bucket of keys equal to that is empty, the next non-empty bucket is emptied into lower ones around its
+ * least key. An element can only ever move down, at most once per bit, so operations cost amortised O(log C), C the largest difference between a key and
+ * the last popped one, with no comparisons between elements and every bucket accessed front to back.
+ * @tparam KeyOf gives the integral key of an element
+ */
+template <typename T, typename KeyOf = std::identity>
+requires std::integral<std::remove_cvref_t<std::invoke_result_t<KeyOf const&, T const&>>>
+class radix_heap {
+public:
+    using value_type = T;
+    using key_type = std::remove_cvref_t<std::invoke_result_t<KeyOf const&, T const&>>;
+
+    radix_heap() = default;
+    explicit radix_heap(KeyOf key_of) : key_of_{key_of} {}
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @throws std::invalid_argument when the key is less than that of the last popped element
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void insert(U&& u) {
+        T value(std::forward<U>(u));
+        auto const key = ordered(key_of_(value));
+        if (key < last_) {
+            throw std::invalid_argument{"The key is less than the last popped one!"};
+        }
+        buckets_[bucket_of(key)].push_back(std::move(value));
+        ++size_;
+    }
+
+    /**
+     * @return an element with the least key, may only be called when not empty()
+     */
+    [[nodiscard]] T const& top() const {
+        if (!buckets_.front().empty()) {
+            return buckets_.front().back();
+        }
+        // found without refilling, which would raise last_ to this key and so reject keys between it and the last popped one before it is even popped
+        auto const source = first_filled_bucket(buckets_);
+        return *std::min_element(source->begin(), source->end(), [this](T const& lhs, T const& rhs) { return key_less(lhs, rhs); });
+    }
+
+    T pop() {
+        if (empty()) {
+            throw std::out_of_range{"The heap is empty!"};
+        }
+        refill();
+        auto top_element = std::move(buckets_.front().back());
+        buckets_.front().pop_back();
+        --size_;
+        return top_element;
+    }
+
+private:
+    using unsigned_key = std::make_unsigned_t<key_type>;
+    static constexpr std::size_t key_bits = std::numeric_limits<unsigned_key>::digits;
+
+    // signed keys are offset so that their order is that of the unsigned ones
+    [[nodiscard]] static constexpr unsigned_key ordered(key_type key) noexcept {
+        if constexpr (std::is_signed_v<key_type>) {
+            return static_cast<unsigned_key>(key) ^ (unsigned_key{1} << (key_bits - 1));
+        } else {
+            return key;
+        }
+    }
+
+    [[nodiscard]] std::size_t bucket_of(unsigned_key key) const noexcept {
+        return static_cast<std::size_t>(std::bit_width(static_cast<unsigned_key>(key ^ last_)));
+    }
+
+    // the first bucket after the keys equal to last_ that holds anything, const or not with the heap
+    template <typename Buckets>
+    [[nodiscard]] static auto first_filled_bucket(Buckets& buckets) noexcept {
+        return std::find_if(buckets.begin() + 1, buckets.end(), [](auto const& bucket) { return !bucket.empty(); });
+    }
+
+    [[nodiscard]] bool key_less(T const& lhs, T const& rhs) const { return ordered(key_of_(lhs)) < ordered(key_of_(rhs)); }
+
+    /**
+     * Makes the first bucket, the keys equal to last_, non-empty. The least key of the next bucket becomes last_, and every element of that bucket agrees
+     * with it on more bits than it did with the old last_, so all of them move to lower buckets. Only pop calls it, so last_ is always the last popped key.
+     */
+    void refill() {
+        if (!buckets_.front().empty()) {
+            return;
+        }
+        auto const source = first_filled_bucket(buckets_);
+        last_ = ordered(key_of_(*std::min_element(source->begin(), source->end(), [this](T const& lhs, T const& rhs) { return key_less(lhs, rhs); })));
+        for (auto& element : *source) {
+            buckets_[bucket_of(ordered(key_of_(element)))].push_back(std::move(element));
         }
+        // clear keeps the capacity, so buckets stop allocating once they have grown to their working size
+        source->clear();
+    }
 
+    std::array<std::vector<T>, key_bits + 1> buckets_;
+    unsigned_key last_ = 0;
+    std::size_t size_ = 0;
+    [[no_unique_address]] KeyOf key_of_;
+};
+
+/**
+ * A double ended priority queue in one array, Atkinson's min-max heap: the levels alternate between min levels, starting with the root, whose nodes are no
+ * greater than anything below them, and max levels, whose nodes are no less. The least element is the root and the greatest one of its two children, so
+ * both ends cost O(1) to look at and O(log n) to pop, with half the memory of a min heap and a max heap side by side and no lazily deleted copies to skip.
+ * A node is compared against its grandchildren, which sit next to each other in the array, four to a group.
+ */
+template <typename T, typename Compare = std::less<>>
+class min_max_heap {
+public:
+    using value_type = T;
+
+    min_max_heap() = default;
+    explicit min_max_heap(Compare comp) : comp_{comp} {}
+
+    /**
+     * Builds the heap from [begin, end) in O(n), trickling every parent down from the last one back, Floyd's way
+     */
+    template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+    requires std::convertible_to<std::iter_reference_t<Iterator>, T>
+    min_max_heap(Iterator begin, Sentinel end, Compare comp = {}) : comp_{comp} {
+        for (; begin != end; ++begin) {
+            arr_.push_back(*begin);
+        }
+        for (auto pos = arr_.size() / 2; pos-- != 0;) {
+            trickle_down(pos);
+        }
         assert(validate());
     }
 
+    [[nodiscard]] bool empty() const noexcept { return arr_.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return arr_.size(); }
+
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void insert(U&& u) {
+        arr_.push_back(std::forward<U>(u));
+        bubble_up(arr_.size() - 1);
+    }
+
+    /**
+     * @return the least element, may only be called when not empty()
+     */
+    [[nodiscard]] T const& min() const noexcept { return arr_.front(); }
+
+    /**
+     * @return the greatest element, may only be called when not empty()
+     */
+    [[nodiscard]] T const& max() const noexcept { return arr_[max_position()]; }
+
+    /**
+     * @throws std::out_of_range when empty
+     */
+    T pop_min() { return pop_at(0); }
+
+    /**
+     * @throws std::out_of_range when empty
+     */
+    T pop_max() {
+        if (empty()) {
+            throw std::out_of_range{"The heap is empty!"};
+        }
+        return pop_at(max_position());
+    }
+
+    [[nodiscard]] bool validate() const {
+        // against the parent and the grandparent, which by induction covers all ancestors
+        for (std::size_t pos = 1; pos < arr_.size(); ++pos) {
+            auto const on_min_level = is_min_level(pos);
+            if (on_min_level ? comp_(arr_[parent(pos)], arr_[pos]) : comp_(arr_[pos], arr_[parent(pos)])) {
+                return false;
+            }
+            if (pos >= 3 && (on_min_level ? comp_(arr_[pos], arr_[parent(parent(pos))]) : comp_(arr_[parent(parent(pos))], arr_[pos]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    [[nodiscard]] static constexpr std::size_t parent(std::size_t pos) noexcept { return (pos - 1) / 2; }
+    [[nodiscard]] static constexpr bool is_min_level(std::size_t pos) noexcept { return std::bit_width(pos + 1) % 2 == 1; }
+
+    // whether `lhs` belongs nearer the root than `rhs` on a min level, or on a max level
+    template <bool Min>
+    [[nodiscard]] bool before(T const& lhs, T const& rhs) const {
+        return Min ? comp_(lhs, rhs) : comp_(rhs, lhs);
+    }
+
+    [[nodiscard]] std::size_t max_position() const noexcept {
+        if (arr_.size() <= 2) {
+            return arr_.size() - 1;
+        }
+        return comp_(arr_[1], arr_[2]) ? 2 : 1;
+    }
+
+    T pop_at(std::size_t pos) {
+        if (empty()) {
+            throw std::out_of_range{"The heap is empty!"};
+        }
+        auto popped = std::move(arr_[pos]);
+        if (pos + 1 != arr_.size()) {
+            arr_[pos] = std::move(arr_.back());
+            arr_.pop_back();
+            trickle_down(pos);
+        } else {
+            arr_.pop_back();
+        }
+        return popped;
+    }
+
+    void bubble_up(std::size_t pos) {
+        if (pos == 0) {
+            return;
+        }
+        auto const up = parent(pos);
+        // an element on the wrong side of its parent belongs to the levels of the parent
+        if (is_min_level(pos) ? comp_(arr_[up], arr_[pos]) : comp_(arr_[pos], arr_[up])) {
+            std::swap(arr_[pos], arr_[up]);
+            pos = up;
+        }
+        is_min_level(pos) ? bubble_up<true>(pos) : bubble_up<false>(pos);
+    }
+
+    // moves a hole up through the grandparents, the levels of one kind
+    template <bool Min>
+    void bubble_up(std::size_t pos) {
+        auto value = std::move(arr_[pos]);
+        while (pos >= 3 && before<Min>(value, arr_[parent(parent(pos))])) {
+            arr_[pos] = std::move(arr_[parent(parent(pos))]);
+            pos = parent(parent(pos));
+        }
+        arr_[pos] = std::move(value);
+    }
+
+    void trickle_down(std::size_t pos) { is_min_level(pos) ? trickle_down<true>(pos) : trickle_down<false>(pos); }
+
+    /**
+     * Moves a hole down through the best of the children and grandchildren. Going down to a grandchild passes a node of the other kind, and the element
+     * may be on the wrong side of it, then the two trade places.
+     */
+    template <bool Min>
+    void trickle_down(std::size_t pos) {
+        auto const size = arr_.size();
+        auto value = std::move(arr_[pos]);
+        while (2 * pos + 1 < size) {
+            auto const first_grandchild = 4 * pos + 3;
+            auto best = 2 * pos + 1;
+            for (auto candidate = best + 1; candidate != std::min(2 * pos + 3, size); ++candidate) {
+                best = before<Min>(arr_[candidate], arr_[best]) ? candidate : best;
+            }
+            for (auto candidate = first_grandchild; candidate < std::min(first_grandchild + 4, size); ++candidate) {
+                best = before<Min>(arr_[candidate], arr_[best]) ? candidate : best;
+            }
+            if (!before<Min>(arr_[best], value)) {
+                break;
+            }
+            arr_[pos] = std::move(arr_[best]);
+            pos = best;
+            if (best < first_grandchild) {
+                break;
+            }
+            if (before<Min>(arr_[parent(pos)], value)) {
+                std::swap(arr_[parent(pos)], value);
+            }
+        }
+        arr_[pos] = std::move(value);
+    }
+
     std::vector<T> arr_;
     Compare comp_;
 };
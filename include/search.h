@@ -1,28 +1,523 @@
 #ifndef ALGO_LAND_SEARCH_H
 #define ALGO_LAND_SEARCH_H
+#include <interleave.h>
+#include <simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
 #include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace algo {
 
+namespace search_details {
+inline void prefetch([[maybe_unused]] void const* address) noexcept {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#endif
+}
+
+/**
+ * Prefetches the probes the step after the current one may make, `next_half` past either half's base. Only for contiguous iterators, anything else would
+ * need dereferencing to get at an address.
+ */
+template <typename Iterator>
+void prefetch_next_probes(Iterator base, std::iter_difference_t<Iterator> half, std::iter_difference_t<Iterator> next_half) noexcept {
+    if constexpr (std::contiguous_iterator<Iterator>) {
+        prefetch(std::to_address(base + next_half));
+        prefetch(std::to_address(base + half + next_half));
+    }
+}
+}  // namespace search_details
+
+/**
+ * Branchless binary search: the first element in [begin, end) that is not less than `value`. Every step halves the range with a conditional move rather than a
+ * branch, so there is nothing for the branch predictor to get wrong, and the number of steps only depends on the size of the range. On contiguous ranges both
+ * probes the next step might make are prefetched, which keeps two cache misses in flight instead of one when the range is bigger than the cache.
+ * @return the first element not less than `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iterator, typename T, typename Compare = std::less<>>
+requires std::indirect_strict_weak_order<Compare, T const*, Iterator>
+Iterator lower_bound(Iterator begin, Iterator end, T const& value, Compare comp = {}) {
+    auto length = end - begin;
+    if (length == 0) {
+        return end;
+    }
+
+    // the answer is always in [begin, begin + length]
+    while (length > 1) {
+        auto const half = length / 2;
+        search_details::prefetch_next_probes(begin, half, (length - half) / 2);
+        begin = comp(begin[half], value) ? begin + half : begin;
+        length -= half;
+    }
+    return comp(*begin, value) ? begin + 1 : begin;
+}
+
+/**
+ * Branchless binary search like lower_bound
+ * @return the first element in [begin, end) that is greater than `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iterator, typename T, typename Compare = std::less<>>
+requires std::indirect_strict_weak_order<Compare, T const*, Iterator>
+Iterator upper_bound(Iterator begin, Iterator end, T const& value, Compare comp = {}) {
+    auto length = end - begin;
+    if (length == 0) {
+        return end;
+    }
+
+    while (length > 1) {
+        auto const half = length / 2;
+        search_details::prefetch_next_probes(begin, half, (length - half) / 2);
+        begin = comp(value, begin[half]) ? begin : begin + half;
+        length -= half;
+    }
+    return comp(value, *begin) ? begin : begin + 1;
+}
+
+/**
+ * @return an element equal to `value`, `end` if there is none
+ */
 template <typename Iter, typename T>
 Iter binary_search(Iter begin, Iter end, T const& value) requires(std::totally_ordered_with<typename std::iterator_traits<Iter>::value_type, T>,
                                                                   std::random_access_iterator<Iter>) {
-    if (begin == end) {
-        return end;
+    auto const found = algo::lower_bound(begin, end, value);
+    return found != end && *found == value ? found : end;
+}
+
+namespace search_details {
+/**
+ * binary_search as an interleaved_lookup, suspending on every probe of a contiguous range until its cache line is in
+ */
+template <typename Iter, typename T>
+interleaved_lookup binary_search_interleaved(Iter begin, Iter end, T const& value, Iter& out) {
+    auto first = begin;
+    auto length = end - begin;
+    out = end;
+    if (length == 0) {
+        co_return;
+    }
+
+    while (length > 1) {
+        auto const half = length / 2;
+        if constexpr (std::contiguous_iterator<Iter>) {
+            co_await prefetch_and_suspend{std::to_address(first + half)};
+        }
+        // a multiply, compilers turn the select back into a branch inside a coroutine
+        first += static_cast<std::iter_difference_t<Iter>>(first[half] < value) * half;
+        length -= half;
+    }
+    if (*first < value) {
+        ++first;
+    }
+    if (first != end && *first == value) {
+        out = first;
+    }
+}
+}  // namespace search_details
+
+/**
+ * binary_search for every element of `values` at once, with `group_size` searches interleaved so that their cache misses overlap, see `run_interleaved`.
+ * Only pays off for contiguous ranges much bigger than the cache, anything else is searched one value after the other.
+ * @param out receives what binary_search would return for every value
+ * @throws std::invalid_argument when `out` is shorter than `values`
+ */
+template <std::random_access_iterator Iter>
+requires std::totally_ordered<std::iter_value_t<Iter>>
+void binary_search_batch(Iter begin, Iter end, std::span<std::iter_value_t<Iter> const> values, std::type_identity_t<std::span<Iter>> out,
+                         std::size_t group_size = default_interleave_group) {
+    if (out.size() < values.size()) {
+        throw std::invalid_argument{"the output is shorter than the values!"};
+    }
+    if constexpr (std::contiguous_iterator<Iter>) {
+        run_interleaved(
+            values.size(), [&](std::size_t i) { return search_details::binary_search_interleaved(begin, end, values[i], out[i]); }, group_size);
     } else {
-        auto mid_point = begin + (end - begin) / 2;
+        for (std::size_t i = 0; i != values.size(); ++i) {
+            out[i] = algo::binary_search(begin, end, values[i]);
+        }
+    }
+}
+
+/**
+ * Exponential (galloping) search outward from `hint`: probes 1, 2, 4, ... elements away from it until the answer is bracketed, then binary searches the
+ * bracket. Costs O(log d) comparisons, d being the distance between `hint` and the answer, so looking up a sequence of nearby values with the previous answer
+ * as the hint is much cheaper than a binary search over all of [begin, end) each time.
+ * @param hint any iterator in [begin, end], where the answer is expected
+ * @return the first element in [begin, end) that is not less than `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iterator, typename T, typename Compare = std::less<>>
+requires std::indirect_strict_weak_order<Compare, T const*, Iterator>
+Iterator exponential_lower_bound(Iterator begin, Iterator end, Iterator hint, T const& value, Compare comp = {}) {
+    std::iter_difference_t<Iterator> step = 1;
+    if (hint == end || !comp(*hint, value)) {
+        // the answer is in [begin, last], gallop to the left
+        auto last = hint;
+        while (last - begin >= step) {
+            auto const probe = last - step;
+            if (comp(*probe, value)) {
+                return algo::lower_bound(probe + 1, last, value, comp);
+            }
+            last = probe;
+            step *= 2;
+        }
+        return algo::lower_bound(begin, last, value, comp);
+    }
+
+    // the answer is in [first, end], gallop to the right
+    auto first = hint + 1;
+    while (end - first >= step) {
+        auto const probe = first + (step - 1);
+        if (!comp(*probe, value)) {
+            return algo::lower_bound(first, probe, value, comp);
+        }
+        first = probe + 1;
+        step *= 2;
+    }
+    return algo::lower_bound(first, end, value, comp);
+}
+
+/**
+ * binary_search by exponential_lower_bound from `hint`
+ * @return an element equal to `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iter, typename T>
+requires std::totally_ordered_with<std::iter_value_t<Iter>, T>
+Iter exponential_search(Iter begin, Iter end, Iter hint, T const& value) {
+    auto const found = algo::exponential_lower_bound(begin, end, hint, value);
+    return found != end && *found == value ? found : end;
+}
 
-        auto comp = *mid_point <=> value;
-        if (comp == std::strong_ordering::equal) {
-            return mid_point;
-        } else if (comp == std::strong_ordering::less) {
-            return binary_search(mid_point, end, value);
+/**
+ * Interpolation search: probes where `value` would be if the elements were spread evenly between the ends of the range that is left, which takes
+ * O(log log n) probes for uniformly distributed keys. Skewed keys can make interpolation shrink the range by as little as one element per probe, so whenever
+ * a probe fails to halve the range the next one bisects it, which bounds the worst case to about twice the probes of a binary search. Small ranges are left to
+ * lower_bound.
+ * @return the first element in [begin, end) that is not less than `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iter, typename T>
+requires std::totally_ordered_with<std::iter_value_t<Iter>, T> && std::is_arithmetic_v<std::iter_value_t<Iter>> && std::is_arithmetic_v<T>
+Iter interpolation_lower_bound(Iter begin, Iter end, T const& value) {
+    constexpr std::iter_difference_t<Iter> small_range = 16;
+
+    // the answer is always in [begin, end]
+    auto bisect = false;
+    while (end - begin > small_range) {
+        auto const length = end - begin;
+        auto const low = static_cast<double>(*begin);
+        auto const high = static_cast<double>(end[-1]);
+        if (!(*begin < value)) {
+            return begin;
+        }
+        if (end[-1] < value) {
+            return end;
+        }
+
+        // *begin < value <= end[-1] from here on, so the answer is in [begin + 1, end - 1]
+        auto offset = length / 2;
+        if (!bisect && low < high) {
+            auto const estimate = (static_cast<double>(value) - low) / (high - low) * static_cast<double>(length - 1);
+            offset = std::clamp(static_cast<std::iter_difference_t<Iter>>(estimate), std::iter_difference_t<Iter>{1}, length - 1);
+        }
+        auto const probe = begin + offset;
+        // the estimate of uniform keys is off by about sqrt(length), a guard probe that far beyond it usually closes the range in from the other side too
+        auto const guard = static_cast<std::iter_difference_t<Iter>>(std::sqrt(static_cast<double>(length)));
+        if (*probe < value) {
+            begin = probe + 1;
+            if (!bisect && end - begin > guard) {
+                auto const guard_probe = begin + guard;
+                *guard_probe < value ? begin = guard_probe + 1 : end = guard_probe;
+            }
         } else {
-            return binary_search(begin, mid_point, value);
+            end = probe;
+            if (!bisect && end - begin > guard) {
+                auto const guard_probe = end - guard;
+                *guard_probe < value ? begin = guard_probe + 1 : end = guard_probe;
+            }
         }
+        bisect = !bisect && end - begin > length / 2;
     }
+    return algo::lower_bound(begin, end, value);
+}
+
+/**
+ * binary_search by interpolation_lower_bound
+ * @return an element equal to `value`, `end` if there is none
+ */
+template <std::random_access_iterator Iter, typename T>
+requires std::totally_ordered_with<std::iter_value_t<Iter>, T> && std::is_arithmetic_v<std::iter_value_t<Iter>> && std::is_arithmetic_v<T>
+Iter interpolation_search(Iter begin, Iter end, T const& value) {
+    auto const found = algo::interpolation_lower_bound(begin, end, value);
+    return found != end && *found == value ? found : end;
 }
+
+/**
+ * A sorted range laid out in breadth first order, as the implicit binary search tree Eytzinger used for genealogies: the root at index 1 and the children of
+ * index k at 2k and 2k + 1. The first levels of the tree, the ones every search goes through, are packed together at the front and stay cached, and a
+ * node's descendants a cache line's worth of elements further down are next to each other, so a single prefetch hides the latency of several levels. Lookups
+ * do not branch on the outcome of comparisons either, which makes them several times faster than a binary search on a sorted array once it no longer fits in
+ * the cache.
+ * @tparam T the element type
+ * @tparam Compare the order the range is sorted in
+ */
+template <std::semiregular T, typename Compare = std::less<>>
+class eytzinger_array {
+public:
+    using value_type = T;
+    using const_iterator = T const*;
+
+    /**
+     * @param begin, end a range sorted according to `comp`
+     */
+    template <std::input_iterator Iterator>
+    eytzinger_array(Iterator begin, Iterator end, Compare comp = {}) : comp_{comp} {
+        std::vector<T> sorted(begin, end);
+        // index 0 is never used so that the children of k are at 2k and 2k + 1
+        tree_.resize(sorted.size() + 1);
+        std::size_t next = 0;
+        fill(sorted, next, 1);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return tree_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * The elements in breadth first order, not sorted
+     */
+    [[nodiscard]] const_iterator begin() const noexcept { return tree_.data() + 1; }
+    [[nodiscard]] const_iterator end() const noexcept { return tree_.data() + tree_.size(); }
+
+    /**
+     * @return the smallest element not less than `value`, end() if there is none
+     */
+    template <typename U>
+    [[nodiscard]] const_iterator lower_bound(U const& value) const {
+        return descend([&](T const& element) { return comp_(element, value); });
+    }
+
+    /**
+     * @return the smallest element greater than `value`, end() if there is none
+     */
+    template <typename U>
+    [[nodiscard]] const_iterator upper_bound(U const& value) const {
+        return descend([&](T const& element) { return !comp_(value, element); });
+    }
+
+    template <typename U>
+    [[nodiscard]] bool contains(U const& value) const {
+        auto const found = lower_bound(value);
+        return found != end() && !comp_(value, *found);
+    }
+
+private:
+    // in order traversal of the implicit tree hands out the sorted elements in order
+    void fill(std::vector<T>& sorted, std::size_t& next, std::size_t k) {
+        if (k < tree_.size()) {
+            fill(sorted, next, 2 * k);
+            tree_[k] = std::move(sorted[next++]);
+            fill(sorted, next, 2 * k + 1);
+        }
+    }
+
+    /**
+     * Goes right past every element `go_right` holds for and left otherwise, until it falls off the tree. The path taken is k's binary digits after the
+     * leading one, the last left turn is where the search would have stopped, so undoing the trailing right turns and that left turn gives the answer.
+     */
+    template <typename Predicate>
+    [[nodiscard]] const_iterator descend(Predicate go_right) const {
+        // a cache line holds this many elements, the descendants of k log2(stride) levels down start at k * stride
+        constexpr std::size_t stride = std::max<std::size_t>(std::bit_floor(64 / sizeof(T)), 1);
+
+        std::size_t k = 1;
+        while (k < tree_.size()) {
+            if (k * stride < tree_.size()) {
+                search_details::prefetch(tree_.data() + k * stride);
+            }
+            k = 2 * k + static_cast<std::size_t>(go_right(tree_[k]));
+        }
+        k >>= std::countr_one(k) + 1;
+        return k == 0 ? end() : tree_.data() + k;
+    }
+
+    std::vector<T> tree_;
+    Compare comp_;
+};
+
+namespace search_details {
+/**
+ * Keys per node of the static search tree, a cache line of 32 bit keys
+ */
+inline constexpr std::size_t tree_node_keys = 16;
+
+struct aligned_deleter {
+    void operator()(std::int32_t* keys) const noexcept { ::operator delete(keys, std::align_val_t{64}); }
+};
+
+/**
+ * Counts the keys of a node that are less than `value`, which is the child to go down into, or the position in a leaf
+ */
+inline std::size_t count_less_scalar(std::int32_t const* node, std::int32_t value) noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != tree_node_keys; ++i) {
+        count += static_cast<std::size_t>(node[i] < value);
+    }
+    return count;
+}
+
+#ifdef ALGO_LAND_SIMD
+[[gnu::target("avx2,popcnt")]] inline std::size_t count_less_avx2(std::int32_t const* node, std::int32_t value) noexcept {
+    auto const broadcast = _mm256_set1_epi32(value);
+    auto const low = _mm256_cmpgt_epi32(broadcast, _mm256_load_si256(reinterpret_cast<__m256i const*>(node)));
+    auto const high = _mm256_cmpgt_epi32(broadcast, _mm256_load_si256(reinterpret_cast<__m256i const*>(node + 8)));
+    auto const mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(low))) |
+                      (static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(high))) << 8);
+    return static_cast<std::size_t>(_mm_popcnt_u32(mask));
+}
+
+[[gnu::target("avx512f,popcnt")]] inline std::size_t count_less_avx512(std::int32_t const* node, std::int32_t value) noexcept {
+    auto const mask = _mm512_cmplt_epi32_mask(_mm512_load_si512(node), _mm512_set1_epi32(value));
+    return static_cast<std::size_t>(_mm_popcnt_u32(mask));
+}
+#endif
+
+/**
+ * Where a static search tree's layers are: `offsets[h]` is the first node of layer h, layer 0 holds the sorted keys and the last one the root
+ */
+struct tree_layout {
+    std::int32_t const* keys;
+    std::vector<std::size_t> const& offsets;
+};
+
+/**
+ * @return the position of the first key not less than `value` in the leaves, which may be past the real keys and into the padding
+ */
+template <typename CountLess>
+std::size_t tree_lower_bound(tree_layout const& layout, std::int32_t value, CountLess count_less) noexcept {
+    std::size_t node = 0;
+    for (auto layer = layout.offsets.size() - 1; layer != 0; --layer) {
+        node = node * (tree_node_keys + 1) + count_less(layout.keys + (layout.offsets[layer] + node) * tree_node_keys, value);
+    }
+    return node * tree_node_keys + count_less(layout.keys + node * tree_node_keys, value);
+}
+
+#ifdef ALGO_LAND_SIMD
+[[gnu::target("avx2,popcnt"), gnu::flatten]] inline std::size_t tree_lower_bound_avx2(tree_layout const& layout, std::int32_t value) noexcept {
+    return tree_lower_bound(layout, value, count_less_avx2);
+}
+
+[[gnu::target("avx512f,popcnt"), gnu::flatten]] inline std::size_t tree_lower_bound_avx512(tree_layout const& layout, std::int32_t value) noexcept {
+    return tree_lower_bound(layout, value, count_less_avx512);
+}
+#endif
+}  // namespace search_details
+
+/**
+ * An immutable B+ tree over 32 bit keys with implicit child indexing, the static search tree ("S+ tree") of Khuong and Morin and of Algorithmica. Every node
+ * is one cache line of 16 keys, compared against the searched value all at once with AVX-512 or AVX2, and the 17 children of node k of a layer are nodes
+ * 17k to 17k + 16 of the layer below, so no pointers are stored. An inner key is the smallest key of the child subtree to its right. The leaves are the
+ * sorted keys themselves, so a lookup ends at a position in sorted order, and begin() to end() is the sorted range. Counting how many keys of a node are
+ * less than the value gives the child to descend into without a single branch, and a lookup only touches log17(n / 16) + 1 cache lines, against log2(n)
+ * for binary search.
+ */
+class static_search_tree {
+public:
+    using value_type = std::int32_t;
+    using const_iterator = value_type const*;
+
+    /**
+     * @param begin, end a range sorted in ascending order
+     * @param level the instruction set nodes are searched with, the widest the machine has by default
+     */
+    template <std::input_iterator Iterator>
+    requires std::convertible_to<std::iter_reference_t<Iterator>, value_type>
+    static_search_tree(Iterator begin, Iterator end, simd_level level = cpu_simd_level()) : level_{level} {
+        using search_details::tree_node_keys;
+        std::vector<value_type> sorted(begin, end);
+        size_ = sorted.size();
+
+        // layer sizes in nodes, from the leaves up to the root
+        std::vector<std::size_t> layer_nodes{std::max<std::size_t>(1, (size_ + tree_node_keys - 1) / tree_node_keys)};
+        while (layer_nodes.back() > 1) {
+            layer_nodes.push_back((layer_nodes.back() + tree_node_keys) / (tree_node_keys + 1));
+        }
+        offsets_.resize(layer_nodes.size());
+        std::exclusive_scan(layer_nodes.begin(), layer_nodes.end(), offsets_.begin(), std::size_t{0});
+
+        auto const total_keys = (offsets_.back() + layer_nodes.back()) * tree_node_keys;
+        keys_.reset(static_cast<value_type*>(::operator new(total_keys * sizeof(value_type), std::align_val_t{64})));
+
+        // leaves, padded with keys no value is greater than so that padding is never counted as less
+        auto const padding = std::numeric_limits<value_type>::max();
+        std::copy(sorted.begin(), sorted.end(), keys_.get());
+        std::fill(keys_.get() + size_, keys_.get() + layer_nodes.front() * tree_node_keys, padding);
+
+        for (std::size_t layer = 1; layer != layer_nodes.size(); ++layer) {
+            for (std::size_t node = 0; node != layer_nodes[layer]; ++node) {
+                for (std::size_t i = 0; i != tree_node_keys; ++i) {
+                    // the smallest key of the subtree right of key i is the first key of its leftmost leaf
+                    auto leaf = node * (tree_node_keys + 1) + i + 1;
+                    for (auto below = layer - 1; below != 0; --below) {
+                        leaf *= tree_node_keys + 1;
+                    }
+                    keys_[(offsets_[layer] + node) * tree_node_keys + i] = leaf < layer_nodes.front() ? keys_[leaf * tree_node_keys] : padding;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * The keys in sorted order
+     */
+    [[nodiscard]] const_iterator begin() const noexcept { return keys_.get(); }
+    [[nodiscard]] const_iterator end() const noexcept { return keys_.get() + size_; }
+
+    /**
+     * @return the first key not less than `value`, end() if there is none
+     */
+    [[nodiscard]] const_iterator lower_bound(value_type value) const noexcept {
+        search_details::tree_layout const layout{keys_.get(), offsets_};
+        std::size_t position;
+        switch (level_) {
+#ifdef ALGO_LAND_SIMD
+            case simd_level::avx512:
+                position = search_details::tree_lower_bound_avx512(layout, value);
+                break;
+            case simd_level::avx2:
+                position = search_details::tree_lower_bound_avx2(layout, value);
+                break;
+#endif
+            default:
+                position = search_details::tree_lower_bound(layout, value, search_details::count_less_scalar);
+                break;
+        }
+        return keys_.get() + std::min(position, size_);
+    }
+
+    [[nodiscard]] bool contains(value_type value) const noexcept {
+        auto const found = lower_bound(value);
+        return found != end() && *found == value;
+    }
+
+private:
+    std::unique_ptr<value_type[], search_details::aligned_deleter> keys_;
+    std::vector<std::size_t> offsets_;
+    std::size_t size_ = 0;
+    simd_level level_;
+};
 }  // namespace algo
 #endif  // ALGO_LAND_SEARCH_H
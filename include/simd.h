@@ -0,0 +1,35 @@
+#ifndef ALGO_LAND_SIMD_H
+#define ALGO_LAND_SIMD_H
+
+// the SIMD kernels rely on GCC's vector extensions and target attributes, other compilers and architectures get the scalar code
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define ALGO_LAND_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace algo {
+/**
+ * The instruction sets the SIMD kernels are compiled for, each kernel is picked at run time so that one binary runs everywhere
+ */
+enum class simd_level { scalar, avx2, avx512 };
+
+/**
+ * The widest instruction set the kernels can use on this machine, determined once
+ */
+inline simd_level cpu_simd_level() noexcept {
+    static simd_level const level = [] {
+#ifdef ALGO_LAND_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return simd_level::avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return simd_level::avx2;
+        }
+#endif
+        return simd_level::scalar;
+    }();
+    return level;
+}
+}  // namespace algo
+#endif  // ALGO_LAND_SIMD_H
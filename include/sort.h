@@ -4,11 +4,448 @@
 
 #ifndef ALGO_LAND_SORT_H
 #define ALGO_LAND_SORT_H
-#include <priority_queue.h>
+#include <simd.h>
+#include <thread_pool.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace algo {
+namespace sort_details {
+/**
+ * Keys the SIMD kernels below handle: 32 and 64 bit signed integers and floating point numbers, ordered by std::less
+ */
+template <typename T>
+concept simd_key = (std::same_as<T, int> || std::same_as<T, long> || std::same_as<T, long long> || std::same_as<T, float> || std::same_as<T, double>) &&
+                   (sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename Iterator, typename Compare>
+concept simd_sortable = std::contiguous_iterator<Iterator> && simd_key<std::iter_value_t<Iterator>> &&
+                        (std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<std::iter_value_t<Iterator>>>);
+
+/**
+ * Ranges up to this size are sorted by a sorting network when a SIMD kernel is available, they replace insertion sort as the leaves of quicksort
+ */
+inline constexpr std::ptrdiff_t simd_network_size = 64;
+
+#ifdef ALGO_LAND_SIMD
+/**
+ * Bitonic sorting network on `Registers` vectors of `Bytes` bytes, written with GCC's generic vector extensions so that one implementation serves every key
+ * type and register width. Compiled into the AVX2 and AVX-512 kernels, which inline all of it. Every stage of a bitonic sort of N = 2^k elements first
+ * compares the mirror images within blocks of size b and then runs half cleaners of strides b/4, ..., 1, which always put the smaller element at the lower
+ * index so no direction masks are needed. Strides of at least a vector are plain vertical min/max between registers, smaller ones shuffle lanes within a
+ * register.
+ */
+template <typename T, std::size_t Bytes, std::size_t Registers>
+struct bitonic_network {
+    using lane_index = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+    typedef T vector __attribute__((vector_size(Bytes)));
+    typedef lane_index index __attribute__((vector_size(Bytes)));
+
+    static constexpr std::size_t lanes = Bytes / sizeof(T);
+    static constexpr std::size_t size = lanes * Registers;
+
+    static void sort(vector (&registers)[Registers]) noexcept { sort_stage<2>(registers); }
+
+private:
+    // vectors are passed by reference throughout, by value they would depend on the ABI of the instruction set compiled for
+    template <typename F>
+    static void make_index(index& result, F f) noexcept {
+        for (std::size_t lane = 0; lane != lanes; ++lane) {
+            result[lane] = static_cast<lane_index>(f(lane));
+        }
+    }
+
+    // the smaller of a and b goes to a, the bigger to b. Selecting both sides with the same comparison swaps or keeps the pair as a whole, but that only
+    // keeps the keys a permutation within the network: a NaN still trades places with the padding, see network_sort.
+    static void compare_exchange(vector& a, vector& b) noexcept {
+        auto const less = a < b;
+        vector const low = less ? a : b;
+        b = less ? b : a;
+        a = low;
+    }
+
+    // compare exchange between the lanes of one register, lane l against lane l ^ distance_mask, the lane with bit `lower_bit` clear takes the minimum
+    template <std::size_t DistanceMask, std::size_t LowerBit>
+    static void compare_exchange_lanes(vector& v) noexcept {
+        index partners;
+        make_index(partners, [](std::size_t lane) { return lane ^ DistanceMask; });
+        index is_lower;
+        make_index(is_lower, [](std::size_t lane) { return (lane & LowerBit) == 0 ? -1 : 0; });
+        vector const partner = __builtin_shuffle(v, partners);
+        auto const less = v < partner;
+        auto const partner_less = __builtin_shuffle(less, partners);
+        // the lower lane keeps its key when it is the smaller one, the upper lane when its partner is the smaller one
+        v = (is_lower ? less : partner_less) ? v : partner;
+    }
+
+    static void reverse(vector& v) noexcept {
+        index reversed;
+        make_index(reversed, [](std::size_t lane) { return lanes - 1 - lane; });
+        v = __builtin_shuffle(v, reversed);
+    }
+
+    template <std::size_t Block>
+    static void sort_stage(vector (&registers)[Registers]) noexcept {
+        if constexpr (Block <= size) {
+            mirror<Block>(registers);
+            half_clean<Block / 4>(registers);
+            sort_stage<Block * 2>(registers);
+        }
+    }
+
+    template <std::size_t Block>
+    static void mirror(vector (&registers)[Registers]) noexcept {
+        if constexpr (Block <= lanes) {
+            for (auto& v : registers) {
+                compare_exchange_lanes<Block - 1, Block / 2>(v);
+            }
+        } else {
+            constexpr std::size_t block_registers = Block / lanes;
+            for (std::size_t first = 0; first != Registers; first += block_registers) {
+                for (std::size_t i = 0; i != block_registers / 2; ++i) {
+                    auto& low = registers[first + i];
+                    auto& high = registers[first + block_registers - 1 - i];
+                    reverse(high);
+                    compare_exchange(low, high);
+                    reverse(high);
+                }
+            }
+        }
+    }
+
+    template <std::size_t Stride>
+    static void half_clean(vector (&registers)[Registers]) noexcept {
+        if constexpr (Stride >= lanes) {
+            constexpr std::size_t register_stride = Stride / lanes;
+            for (std::size_t i = 0; i != Registers; ++i) {
+                if ((i & register_stride) == 0) {
+                    compare_exchange(registers[i], registers[i + register_stride]);
+                }
+            }
+            half_clean<Stride / 2>(registers);
+        } else if constexpr (Stride >= 1) {
+            for (auto& v : registers) {
+                compare_exchange_lanes<Stride, Stride>(v);
+            }
+            half_clean<Stride / 2>(registers);
+        }
+    }
+};
+
+/**
+ * Sorts up to simd_network_size keys with the smallest network that fits them, the unused slots are padded with the biggest key
+ * @return false, leaving the keys untouched, when one of them is a NaN. A NaN compares false both ways, so the network may swap it into the padding and
+ * copy back a padding infinity in its place.
+ */
+template <typename T, std::size_t Bytes, std::size_t Registers = 1>
+bool network_sort(T* data, std::size_t size) noexcept {
+    using network = bitonic_network<T, Bytes, Registers>;
+    if constexpr (network::size < static_cast<std::size_t>(simd_network_size)) {
+        if (size > network::size) {
+            return network_sort<T, Bytes, Registers * 2>(data, size);
+        }
+    }
+
+    typename network::vector registers[Registers];
+    std::memcpy(registers, data, size * sizeof(T));
+    constexpr T padding = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    for (auto i = size; i != network::size; ++i) {
+        registers[i / network::lanes][i % network::lanes] = padding;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        // one unordered compare per register, a NaN is the only key unequal to itself
+        typename network::index unordered{};
+        for (auto const& v : registers) {
+            unordered |= v != v;
+        }
+        for (std::size_t lane = 0; lane != network::lanes; ++lane) {
+            if (unordered[lane] != 0) {
+                return false;
+            }
+        }
+    }
+    network::sort(registers);
+    std::memcpy(data, registers, size * sizeof(T));
+    return true;
+}
+
+/**
+ * Compress permutations for AVX2, which has no compress instruction: entry `mask` moves the lanes whose bit is clear in `mask` to the front and the others
+ * behind them, both in their original order. Expressed in 32 bit lanes so that one variable permute serves 4 and 8 byte keys.
+ */
+template <std::size_t Lanes>
+inline constexpr auto compress_permutations = [] {
+    constexpr std::size_t parts = 8 / Lanes;
+    std::array<std::array<std::uint32_t, 8>, std::size_t{1} << Lanes> table{};
+    for (std::size_t mask = 0; mask != table.size(); ++mask) {
+        std::size_t out = 0;
+        for (std::size_t side : {0, 1}) {
+            for (std::size_t lane = 0; lane != Lanes; ++lane) {
+                if (((mask >> lane) & 1) == side) {
+                    for (std::size_t part = 0; part != parts; ++part) {
+                        table[mask][out++] = static_cast<std::uint32_t>(lane * parts + part);
+                    }
+                }
+            }
+        }
+    }
+    return table;
+}();
+
+/**
+ * The AVX2 operations `vector_partition` is written against. Registers go by reference, for the same reason as in `bitonic_network`.
+ */
+template <typename T>
+struct avx2_ops {
+    static constexpr std::size_t lanes = 32 / sizeof(T);
+    using vector = __m256i;
+
+    [[gnu::target("avx2")]] static void load(T const* data, vector& v) noexcept { v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data)); }
+
+    [[gnu::target("avx2")]] static void broadcast(T value, vector& v) noexcept {
+        T values[lanes];
+        std::fill_n(values, lanes, value);
+        load(values, v);
+    }
+
+    /**
+     * @return a bit per lane, set when the lane is bigger (`strict`) or no smaller than the pivot
+     */
+    [[gnu::target("avx2")]] static unsigned right_mask(vector const& v, vector const& pivot, bool strict) noexcept {
+        constexpr unsigned all = (1U << lanes) - 1;
+        if constexpr (std::is_same_v<T, float>) {
+            auto const x = _mm256_castsi256_ps(v);
+            auto const p = _mm256_castsi256_ps(pivot);
+            return static_cast<unsigned>(_mm256_movemask_ps(strict ? _mm256_cmp_ps(x, p, _CMP_GT_OQ) : _mm256_cmp_ps(x, p, _CMP_GE_OQ)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            auto const x = _mm256_castsi256_pd(v);
+            auto const p = _mm256_castsi256_pd(pivot);
+            return static_cast<unsigned>(_mm256_movemask_pd(strict ? _mm256_cmp_pd(x, p, _CMP_GT_OQ) : _mm256_cmp_pd(x, p, _CMP_GE_OQ)));
+        } else if constexpr (sizeof(T) == 4) {
+            auto const greater = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pivot))));
+            auto const less = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v))));
+            return strict ? greater : ~less & all;
+        } else {
+            auto const greater = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, pivot))));
+            auto const less = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivot, v))));
+            return strict ? greater : ~less & all;
+        }
+    }
+
+    /**
+     * Writes the lanes with a clear bit to `data + left` and those with a set bit to the end of [.., data + right). Both stores write a whole register, the
+     * partition loop guarantees that the lanes stored in excess land on free slots.
+     */
+    [[gnu::target("avx2")]] static void compress_store(T* data, std::size_t left, std::size_t right, vector const& v, unsigned mask) noexcept {
+        auto const permutation = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(compress_permutations<lanes>[mask].data()));
+        auto const compressed = _mm256_permutevar8x32_epi32(v, permutation);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + left), compressed);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + right - lanes), compressed);
+    }
+};
+
+template <typename T>
+struct avx512_ops {
+    static constexpr std::size_t lanes = 64 / sizeof(T);
+    using vector = __m512i;
+
+    [[gnu::target("avx512f")]] static void load(T const* data, vector& v) noexcept { v = _mm512_loadu_si512(data); }
+
+    [[gnu::target("avx512f")]] static void broadcast(T value, vector& v) noexcept {
+        T values[lanes];
+        std::fill_n(values, lanes, value);
+        load(values, v);
+    }
+
+    [[gnu::target("avx512f")]] static unsigned right_mask(vector const& v, vector const& pivot, bool strict) noexcept {
+        if constexpr (std::is_same_v<T, float>) {
+            auto const x = _mm512_castsi512_ps(v);
+            auto const p = _mm512_castsi512_ps(pivot);
+            return strict ? _mm512_cmp_ps_mask(x, p, _CMP_GT_OQ) : _mm512_cmp_ps_mask(x, p, _CMP_GE_OQ);
+        } else if constexpr (std::is_same_v<T, double>) {
+            auto const x = _mm512_castsi512_pd(v);
+            auto const p = _mm512_castsi512_pd(pivot);
+            return strict ? _mm512_cmp_pd_mask(x, p, _CMP_GT_OQ) : _mm512_cmp_pd_mask(x, p, _CMP_GE_OQ);
+        } else if constexpr (sizeof(T) == 4) {
+            return strict ? _mm512_cmpgt_epi32_mask(v, pivot) : _mm512_cmpge_epi32_mask(v, pivot);
+        } else {
+            return strict ? _mm512_cmpgt_epi64_mask(v, pivot) : _mm512_cmpge_epi64_mask(v, pivot);
+        }
+    }
+
+    // only the selected lanes are stored, so unlike AVX2 nothing is written past them
+    [[gnu::target("avx512f")]] static void compress_store(T* data, std::size_t left, std::size_t right, vector const& v, unsigned mask) noexcept {
+        auto const right_count = static_cast<std::size_t>(std::popcount(mask));
+        if constexpr (sizeof(T) == 4) {
+            _mm512_mask_compressstoreu_epi32(data + left, static_cast<__mmask16>(~mask), v);
+            _mm512_mask_compressstoreu_epi32(data + right - right_count, static_cast<__mmask16>(mask), v);
+        } else {
+            _mm512_mask_compressstoreu_epi64(data + left, static_cast<__mmask8>(~mask), v);
+            _mm512_mask_compressstoreu_epi64(data + right - right_count, static_cast<__mmask8>(mask), v);
+        }
+    }
+};
+
+/**
+ * In-place vectorized partition of [data, data + size) around `pivot`, after Bramas' "A Novel Hybrid Quicksort Algorithm Vectorized using AVX-512 on Intel
+ * Skylake". The first and the last register are set aside, which leaves one register of free slots on either side. Every round loads a register from the
+ * side with fewer free slots and compress-stores its keys to the free slots on the left and on the right. Keys equal to the pivot go right in every other
+ * register and left in the others, so that many duplicates still split evenly.
+ * @return the size of the left part, everything in it is no bigger than the pivot and everything after it no smaller
+ */
+template <typename Ops, typename T>
+std::size_t vector_partition(T* data, std::size_t size, T pivot) noexcept {
+    constexpr auto lanes = Ops::lanes;
+    std::size_t left = 0;
+    std::size_t right = size;
+    // scalar steps until the rest is a whole number of registers
+    for (auto i = size % lanes; i != 0; --i) {
+        if (data[left] < pivot) {
+            ++left;
+        } else {
+            std::swap(data[left], data[--right]);
+        }
+    }
+    if (left == right) {
+        return left;
+    }
+
+    typename Ops::vector pivots;
+    Ops::broadcast(pivot, pivots);
+    std::size_t left_store = left;
+    std::size_t right_store = right;
+    bool strict = false;
+    auto const store = [&](typename Ops::vector const& v) {
+        auto const mask = Ops::right_mask(v, pivots, strict);
+        strict = !strict;
+        Ops::compress_store(data, left_store, right_store, v, mask);
+        auto const right_count = static_cast<std::size_t>(std::popcount(mask));
+        left_store += lanes - right_count;
+        right_store -= right_count;
+    };
+
+    typename Ops::vector v;
+    if (right - left == lanes) {
+        Ops::load(data + left, v);
+        store(v);
+        return left_store;
+    }
+
+    typename Ops::vector first;
+    typename Ops::vector last;
+    Ops::load(data + left, first);
+    Ops::load(data + right - lanes, last);
+    left += lanes;
+    right -= lanes;
+    while (left != right) {
+        // loading from the side with fewer free slots leaves at least a register of them on both sides
+        if (right_store - right < left - left_store) {
+            right -= lanes;
+            Ops::load(data + right, v);
+        } else {
+            Ops::load(data + left, v);
+            left += lanes;
+        }
+        store(v);
+    }
+    store(first);
+    store(last);
+    return left_store;
+}
+
+template <typename T>
+[[gnu::target("avx2"), gnu::flatten]] bool network_sort_avx2(T* data, std::size_t size) noexcept {
+    return network_sort<T, 32>(data, size);
+}
+
+template <typename T>
+[[gnu::target("avx512f"), gnu::flatten]] bool network_sort_avx512(T* data, std::size_t size) noexcept {
+    return network_sort<T, 64>(data, size);
+}
+
+template <typename T>
+[[gnu::target("avx2"), gnu::flatten]] std::size_t vector_partition_avx2(T* data, std::size_t size, T pivot) noexcept {
+    return vector_partition<avx2_ops<T>>(data, size, pivot);
+}
+
+template <typename T>
+[[gnu::target("avx512f"), gnu::flatten]] std::size_t vector_partition_avx512(T* data, std::size_t size, T pivot) noexcept {
+    return vector_partition<avx512_ops<T>>(data, size, pivot);
+}
+#endif
+
+/**
+ * Sorts [data, data + size) with the widest sorting network `level` allows
+ * @return false, leaving the keys untouched, when there is no kernel for `level`, size is over simd_network_size or a key is a NaN
+ */
+template <simd_key T>
+bool simd_network_sort(T* data, std::size_t size, simd_level level = cpu_simd_level()) noexcept {
+#ifdef ALGO_LAND_SIMD
+    if (size <= static_cast<std::size_t>(simd_network_size)) {
+        switch (level) {
+            case simd_level::avx512:
+                return network_sort_avx512(data, size);
+            case simd_level::avx2:
+                return network_sort_avx2(data, size);
+            case simd_level::scalar:
+                break;
+        }
+    }
+#endif
+    static_cast<void>(data);
+    static_cast<void>(size);
+    static_cast<void>(level);
+    return false;
+}
+
+/**
+ * Partitions [data, data + size) around `pivot` with the widest kernel `level` allows, see `vector_partition`
+ * @return the size of the left part, or nothing when there is no kernel for `level` and T
+ */
+template <simd_key T>
+std::optional<std::size_t> simd_partition(T* data, std::size_t size, T pivot, simd_level level = cpu_simd_level()) noexcept {
+#ifdef ALGO_LAND_SIMD
+    switch (level) {
+        case simd_level::avx512:
+            return vector_partition_avx512(data, size, pivot);
+        case simd_level::avx2:
+            // four lanes per register do not beat the scalar block partition
+            if constexpr (sizeof(T) == 4) {
+                return vector_partition_avx2(data, size, pivot);
+            }
+            break;
+        case simd_level::scalar:
+            break;
+    }
+#endif
+    static_cast<void>(data);
+    static_cast<void>(size);
+    static_cast<void>(pivot);
+    static_cast<void>(level);
+    return std::nullopt;
+}
+}  // namespace sort_details
+
 template <typename T>
 void selection_sort(std::vector<T>& vec) noexcept {
     for (auto iterator = vec.begin(); iterator != vec.end(); ++iterator) {
@@ -23,14 +460,41 @@ void selection_sort(std::vector<T>& vec) noexcept {
     assert(std::is_sorted(vec.begin(), vec.end()));
 }
 
-template <typename T>
-void insertion_sort(std::vector<T>& vec) noexcept {
-    for (auto front_iter = std::next(vec.begin()); front_iter != vec.end(); ++front_iter) {
-        // goes from the end of sorted bit and
-        for (auto middle_iter = front_iter; middle_iter != vec.begin() && *middle_iter < *std::prev(middle_iter); --middle_iter) {
-            std::swap(middle_iter, std::prev(middle_iter));
+/**
+ * Sorts [begin, end) by shifting every element left until it meets one that is not bigger. Quadratic in general but very fast on tiny or nearly sorted
+ * ranges, which is why the quicksorts below hand their leaves to it. Contiguous ranges of up to 64 ints, longs, floats or doubles ordered by std::less are
+ * sorted by a SIMD sorting network instead, where the CPU supports AVX2 or AVX-512.
+ * @tparam BiDirectionalIterator must satisfy the requirement of LegacyBidirectionalIterator
+ */
+template <typename BiDirectionalIterator, typename Compare = std::less<>>
+void insertion_sort(BiDirectionalIterator begin, BiDirectionalIterator end, Compare comp = {}) {
+    if constexpr (sort_details::simd_sortable<BiDirectionalIterator, Compare>) {
+        if (sort_details::simd_network_sort(std::to_address(begin), static_cast<std::size_t>(end - begin))) {
+            return;
         }
     }
+    if (begin == end) {
+        return;
+    }
+    for (auto front_iter = std::next(begin); front_iter != end; ++front_iter) {
+        // goes from the end of sorted bit towards the front, moving the hole instead of swapping at every step
+        auto value = std::move(*front_iter);
+        auto hole = front_iter;
+        while (hole != begin) {
+            auto const prev_iter = std::prev(hole);
+            if (!comp(value, *prev_iter)) {
+                break;
+            }
+            *hole = std::move(*prev_iter);
+            hole = prev_iter;
+        }
+        *hole = std::move(value);
+    }
+}
+
+template <typename T>
+void insertion_sort(std::vector<T>& vec) noexcept {
+    insertion_sort(vec.begin(), vec.end());
     assert(std::is_sorted(vec.begin(), vec.end()));
 }
 
@@ -50,9 +514,167 @@ void bubble_sort(std::vector<T>& vec) {
     assert(std::is_sorted(vec.begin(), vec.end()));
 }
 
+namespace sort_details {
+/**
+ * Hoare style partition around the element at prev(end)
+ * @return An iterator to the final position of the pivot
+ */
+template <typename BiDirectionalIterator, typename Compare>
+BiDirectionalIterator hoare_partition_pivot_last(BiDirectionalIterator begin, BiDirectionalIterator end, Compare& comp) {
+    using std::prev;
+    auto const pivot_it = prev(end);
+
+    // [begin, front_iter) is no bigger than the pivot, [back_iter, pivot_it) is no smaller than the pivot
+    auto front_iter = begin;
+    auto back_iter = pivot_it;
+
+    while (true) {
+        // the pivot itself stops this scan at the latest
+        while (comp(*front_iter, *pivot_it)) {
+            ++front_iter;
+        }
+
+        // but nothing stops this one, so it must not run past front_iter
+        while (front_iter != back_iter && comp(*pivot_it, *prev(back_iter))) {
+            --back_iter;
+        }
+
+        if (front_iter == back_iter) {
+            break;
+        }
+        --back_iter;
+        if (front_iter == back_iter) {
+            break;
+        }
+
+        std::iter_swap(front_iter, back_iter);
+        ++front_iter;
+    }
+
+    std::iter_swap(front_iter, pivot_it);
+    return front_iter;
+}
+
+/**
+ * Elements a block partition classifies before it swaps, small enough for the offsets to fit an unsigned char and for two blocks to stay in L1
+ */
+inline constexpr std::ptrdiff_t partition_block_size = 64;
+
+/**
+ * Splits [first, last) into elements no bigger than `pivot` followed by elements no smaller than `pivot`
+ * @return the start of the second group
+ */
+template <std::random_access_iterator Iterator, typename T, typename Compare>
+Iterator hoare_split(Iterator first, Iterator last, T const& pivot, Compare& comp) {
+    while (true) {
+        while (first != last && comp(*first, pivot)) {
+            ++first;
+        }
+        while (first != last && comp(pivot, *std::prev(last))) {
+            --last;
+        }
+        if (last - first <= 1) {
+            return first;
+        }
+        std::iter_swap(first, --last);
+        ++first;
+    }
+}
+
+/**
+ * BlockQuicksort partition (Edelkamp and Weiß) around the element at prev(end). Instead of scanning until a misplaced element turns up, which costs a branch
+ * miss about every other element on random data, it classifies a whole block from each end first and only records the offsets of the misplaced elements,
+ * branch free. The recorded elements are then swapped pairwise. Elements equal to the pivot count as misplaced on both ends, just like in the Hoare
+ * partition, so that ranges full of duplicates still split in the middle.
+ * @return An iterator to the final position of the pivot
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+Iterator block_partition_pivot_last(Iterator begin, Iterator end, Compare& comp) {
+    constexpr auto block = partition_block_size;
+
+    // the pivot lives in a local while we partition, a reference into the range would have to be reloaded after every store into the offset buffers since
+    // unsigned char may alias anything
+    auto const pivot_it = std::prev(end);
+    auto pivot = std::move(*pivot_it);
+
+    // [begin, first) is no bigger than the pivot, [last, pivot_it) is no smaller than the pivot
+    auto first = begin;
+    auto last = pivot_it;
+
+    std::array<unsigned char, block> offsets_left;
+    std::array<unsigned char, block> offsets_right;
+    std::ptrdiff_t left_count = 0;
+    std::ptrdiff_t right_count = 0;
+    std::ptrdiff_t left_start = 0;
+    std::ptrdiff_t right_start = 0;
+
+    while (last - first >= 2 * block) {
+        if (left_count == 0) {
+            left_start = 0;
+            for (std::ptrdiff_t i = 0; i != block; ++i) {
+                offsets_left[left_count] = static_cast<unsigned char>(i);
+                left_count += !comp(first[i], pivot);
+            }
+        }
+        if (right_count == 0) {
+            right_start = 0;
+            for (std::ptrdiff_t i = 0; i != block; ++i) {
+                offsets_right[right_count] = static_cast<unsigned char>(i);
+                right_count += !comp(pivot, *(last - 1 - i));
+            }
+        }
+
+        auto const swaps = std::min(left_count, right_count);
+        for (std::ptrdiff_t i = 0; i != swaps; ++i) {
+            std::iter_swap(first + offsets_left[left_start + i], last - 1 - offsets_right[right_start + i]);
+        }
+        left_count -= swaps;
+        right_count -= swaps;
+        left_start += swaps;
+        right_start += swaps;
+
+        // a block is done once all of its misplaced elements are swapped out
+        if (left_count == 0) {
+            first += block;
+        }
+        if (right_count == 0) {
+            last -= block;
+        }
+    }
+
+    // whatever is left, including a block that still has misplaced elements, is less than two blocks and gets the plain treatment
+    auto const split = hoare_split(first, last, pivot, comp);
+    *pivot_it = std::move(*split);
+    *split = std::move(pivot);
+    return split;
+}
+
+/**
+ * Partitions around the element at prev(end), with a SIMD kernel or else the block partition whenever the iterators allow it
+ * @return An iterator to the final position of the pivot
+ */
+template <typename BiDirectionalIterator, typename Compare>
+BiDirectionalIterator partition_pivot_last(BiDirectionalIterator begin, BiDirectionalIterator end, Compare& comp) {
+    if constexpr (simd_sortable<BiDirectionalIterator, Compare>) {
+        auto* const data = std::to_address(begin);
+        auto const size = static_cast<std::size_t>(end - begin) - 1;
+        if (auto const left_size = simd_partition(data, size, data[size])) {
+            std::swap(data[*left_size], data[size]);
+            return begin + static_cast<std::ptrdiff_t>(*left_size);
+        }
+    }
+    if constexpr (std::random_access_iterator<BiDirectionalIterator>) {
+        return block_partition_pivot_last(begin, end, comp);
+    } else {
+        return hoare_partition_pivot_last(begin, end, comp);
+    }
+}
+}  // namespace sort_details
+
 /**
  * Performs a quicksort partition by picking the element in the middle and moving all those that are smaller to the left_ of the element and all those that are
- * bigger to the right of the pivot. The pivot will be the in the correct final position of the sorted range
+ * bigger to the right of the pivot. The pivot will be the in the correct final position of the sorted range. Random access ranges are partitioned block wise
+ * and branch free, see `sort_details::block_partition_pivot_last`
  * @tparam BiDirectionalIterator must satisfy the requirement of LegacyBidirectionalIterator
  * @param begin [begin, end) of a range
  * @param end [begin, end) of a range
@@ -60,44 +682,102 @@ void bubble_sort(std::vector<T>& vec) {
  */
 template <typename BiDirectionalIterator>
 BiDirectionalIterator partition(BiDirectionalIterator begin, BiDirectionalIterator end) noexcept {
-    using std::distance, std::advance, std::prev, std::next;
+    using std::distance, std::prev, std::next;
 
     // pivot_it is the middle element
     // move the pivot to the end
-    std::iter_swap(next(begin, distance(begin, end) / 2), std::prev(end));
-    auto const pivot_it = prev(end);
+    std::iter_swap(next(begin, distance(begin, end) / 2), prev(end));
 
-    auto front_iter = begin;
-    auto back_iter = prev(end, 2);
+    std::less<> comp;
+    return sort_details::partition_pivot_last(begin, end, comp);
+}
 
-    bool manual = false;
+namespace sort_details {
+/**
+ * Bentley-McIlroy three-way partition around the element at `begin`. Elements equal to the pivot are first swapped out to the two ends of the range as the
+ * scans meet them and only moved into the middle once at the end, so a range without duplicates costs hardly more than a two-way partition.
+ * @return [first, last) of the elements equal to the pivot
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+std::pair<Iterator, Iterator> bentley_mcilroy_partition(Iterator begin, Iterator end, Compare& comp) {
+    auto const& pivot = *begin;
 
-    while (distance(begin, front_iter) <= distance(begin, back_iter)) {
-        while (*front_iter < *pivot_it) {
-            ++front_iter;
-        }
+    // [begin, equal_left) and (equal_right, end) equal the pivot, [equal_left, front) is smaller and (back, equal_right] is bigger
+    auto equal_left = std::next(begin);
+    auto front = equal_left;
+    auto back = std::prev(end);
+    auto equal_right = back;
 
-        while (*back_iter > *pivot_it) {
-            --back_iter;
+    while (true) {
+        for (; front <= back && !comp(pivot, *front); ++front) {
+            if (!comp(*front, pivot)) {
+                std::iter_swap(equal_left++, front);
+            }
         }
-
-        if (distance(begin, front_iter) <= distance(begin, back_iter)) {
-            std::iter_swap(front_iter, back_iter);
-            ++front_iter;
-            --back_iter;
+        for (; front <= back && !comp(*back, pivot); --back) {
+            if (!comp(pivot, *back)) {
+                std::iter_swap(back, equal_right--);
+            }
         }
-
-        if (distance(begin, front_iter) > distance(begin, back_iter)) {
-            manual = true;
+        if (front > back) {
             break;
         }
+        std::iter_swap(front++, back--);
+    }
+
+    // move the equal elements from both ends into the middle
+    auto const left_moves = std::min(equal_left - begin, front - equal_left);
+    std::swap_ranges(begin, begin + left_moves, front - left_moves);
+    auto const right_moves = std::min(equal_right - back, std::prev(end) - equal_right);
+    std::swap_ranges(front, front + right_moves, end - right_moves);
+
+    return {begin + (front - equal_left), end - (equal_right - back)};
+}
+
+/**
+ * Dijkstra's Dutch national flag partition around a copy of `pivot`, for ranges that can only be walked step by step
+ * @return [first, last) of the elements equal to the pivot
+ */
+template <typename BiDirectionalIterator, typename Compare>
+std::pair<BiDirectionalIterator, BiDirectionalIterator> dijkstra_partition(BiDirectionalIterator begin, BiDirectionalIterator end,
+                                                                          BiDirectionalIterator pivot_it, Compare& comp) {
+    std::iter_value_t<BiDirectionalIterator> const pivot = *pivot_it;
+
+    // [begin, less_end) is smaller, [less_end, iter) is equal and [greater_begin, end) is bigger than the pivot
+    auto less_end = begin;
+    auto iter = begin;
+    auto greater_begin = end;
+    while (iter != greater_begin) {
+        if (comp(*iter, pivot)) {
+            std::iter_swap(less_end++, iter++);
+        } else if (comp(pivot, *iter)) {
+            std::iter_swap(iter, --greater_begin);
+        } else {
+            ++iter;
+        }
     }
+    return {less_end, greater_begin};
+}
+}  // namespace sort_details
 
-    if (!manual) {
-        std::cout << "manual = " << std::boolalpha << manual << '\n';
+/**
+ * Three-way partition around the element in the middle: everything smaller than the pivot goes to the front, everything bigger to the back and everything
+ * equal in between, where it is already in its final position.
+ * @tparam BiDirectionalIterator must satisfy the requirement of LegacyBidirectionalIterator
+ * @return [first, last) of the elements equal to the pivot
+ */
+template <typename BiDirectionalIterator, typename Compare = std::less<>>
+std::pair<BiDirectionalIterator, BiDirectionalIterator> three_way_partition(BiDirectionalIterator begin, BiDirectionalIterator end, Compare comp = {}) {
+    if (begin == end) {
+        return {begin, end};
+    }
+    auto const middle = std::next(begin, std::distance(begin, end) / 2);
+    if constexpr (std::random_access_iterator<BiDirectionalIterator>) {
+        std::iter_swap(begin, middle);
+        return sort_details::bentley_mcilroy_partition(begin, end, comp);
+    } else {
+        return sort_details::dijkstra_partition(begin, end, middle, comp);
     }
-    std::iter_swap(front_iter, pivot_it);
-    return front_iter;
 }
 
 template <typename Iterator>
@@ -116,26 +796,1432 @@ void quick_sort(std::vector<T>& vec) noexcept {
     assert(std::is_sorted(vec.begin(), vec.end()));
 }
 
-template <typename Iter>
-void heap_sort(Iter begin, Iter end) {
-    ::priority_queue<std::remove_reference_t<decltype(*std::declval<Iter>())>, std::greater<>> heap;
+/**
+ * Tag that selects the introsort flavour of `quick_sort`
+ */
+struct introsort_t {
+    explicit introsort_t() = default;
+};
+inline constexpr introsort_t introsort{};
+
+namespace sort_details {
+/**
+ * Ranges at or below this size are finished off by insertion sort
+ */
+inline constexpr std::ptrdiff_t insertion_sort_threshold = 16;
+
+/**
+ * The size at which quicksort hands a range to `insertion_sort`, which is bigger when that means a SIMD sorting network
+ */
+template <typename Iterator, typename Compare>
+std::ptrdiff_t leaf_size() noexcept {
+    if constexpr (simd_sortable<Iterator, Compare>) {
+        if (cpu_simd_level() != simd_level::scalar) {
+            return simd_network_size;
+        }
+    }
+    return insertion_sort_threshold;
+}
+
+/**
+ * From this size on the pivot is Tukey's ninther (the median of three medians of three) instead of a plain median of three
+ */
+inline constexpr std::ptrdiff_t ninther_threshold = 128;
+
+/**
+ * Sorts the three elements so that *a <= *b <= *c
+ */
+template <typename Iterator, typename Compare>
+void sort3(Iterator a, Iterator b, Iterator c, Compare& comp) {
+    if (comp(*b, *a)) {
+        std::iter_swap(a, b);
+    }
+    if (comp(*c, *b)) {
+        std::iter_swap(b, c);
+        if (comp(*b, *a)) {
+            std::iter_swap(a, b);
+        }
+    }
+}
+
+/**
+ * Picks a pivot for [begin, end) and moves it to prev(end), where `partition_pivot_last` expects it. The samples are sorted in place on the way, which leaves a
+ * small element at the front and a big one at the back of the range for free.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void move_pivot_to_last(Iterator begin, Iterator end, Compare& comp) {
+    auto const size = end - begin;
+    auto const mid = begin + size / 2;
+    auto const last = end - 1;
 
-    for (Iter it = begin; it != end; ++it) {
-        heap.insert(std::move(*it));
+    if (size >= ninther_threshold) {
+        auto const step = size / 8;
+        sort3(begin, begin + step, begin + 2 * step, comp);
+        sort3(mid - step, mid, mid + step, comp);
+        sort3(last - 2 * step, last - step, last, comp);
+        sort3(begin + step, mid, last - step, comp);
+    } else {
+        sort3(begin, mid, last, comp);
     }
-    assert(heap.validate());
+    std::iter_swap(mid, last);
+}
+
+/**
+ * Wegener's bottom-up sift down on the max heap [begin, begin + size): fills the hole at `hole` by walking it down along the bigger children all the way to a
+ * leaf, one comparison per level, then lets `value` climb back up to where it belongs. Since a value that sinks from the top nearly always belongs close to
+ * the bottom, the climb is short and this needs about half the comparisons of the textbook sift down, which compares against both children at every level.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void sift_down_bottom_up(Iterator begin, std::ptrdiff_t hole, std::ptrdiff_t size, std::iter_value_t<Iterator> value, Compare& comp) {
+    auto const top = hole;
 
-    for (Iter it = begin; it != end; ++it) {
-        auto ret = heap.pop();
-        heap.print();
-        std::cout << "Just popped out: " << ret << "\n\n";
-        *it = ret;
+    for (auto child = 2 * hole + 1; child < size; child = 2 * hole + 1) {
+        if (child + 1 < size && comp(begin[child], begin[child + 1])) {
+            ++child;
+        }
+        begin[hole] = std::move(begin[child]);
+        hole = child;
     }
 
-    for (Iter it = begin; it != end; ++it) {
-        std::cout << *it << '\n';
+    while (hole > top) {
+        auto const parent = (hole - 1) / 2;
+        if (!comp(begin[parent], value)) {
+            break;
+        }
+        begin[hole] = std::move(begin[parent]);
+        hole = parent;
     }
-    assert(std::is_sorted(begin, end));
+    begin[hole] = std::move(value);
+}
+
+/**
+ * Floyd's heap construction, O(n): sifts down every inner node from the last one up to the root, so that most of the work happens on the tiny subtrees at the
+ * bottom
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void make_heap_in_place(Iterator begin, Iterator end, Compare& comp) {
+    auto const size = end - begin;
+    for (auto pos = size / 2; pos-- != 0;) {
+        sift_down_bottom_up(begin, pos, size, std::move(begin[pos]), comp);
+    }
+}
+
+/**
+ * In-place heap sort on a max heap laid out over [begin, end). Also the worst case fallback of introsort.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void heap_sort_in_place(Iterator begin, Iterator end, Compare& comp) {
+    make_heap_in_place(begin, end, comp);
+    for (auto last = end - begin - 1; last > 0; --last) {
+        // the top goes to its final place at the back, what was at the back is sifted in from the top
+        auto value = std::move(begin[last]);
+        begin[last] = std::move(*begin);
+        sift_down_bottom_up(begin, 0, last, std::move(value), comp);
+    }
+}
+
+template <std::random_access_iterator Iterator, typename Compare>
+void introsort_loop(Iterator begin, Iterator end, std::size_t depth_limit, Compare& comp) {
+    auto const leaf = leaf_size<Iterator, Compare>();
+    while (end - begin > leaf) {
+        // too many bad pivots in a row, this range is going quadratic
+        if (depth_limit == 0) {
+            heap_sort_in_place(begin, end, comp);
+            return;
+        }
+        --depth_limit;
+
+        move_pivot_to_last(begin, end, comp);
+        auto const pivot_it = partition_pivot_last(begin, end, comp);
+
+        // recurse into the smaller side and loop on the bigger one, so the stack never gets deeper than log2(n)
+        if (pivot_it - begin < end - pivot_it) {
+            introsort_loop(begin, pivot_it, depth_limit, comp);
+            begin = std::next(pivot_it);
+        } else {
+            introsort_loop(std::next(pivot_it), end, depth_limit, comp);
+            end = pivot_it;
+        }
+    }
+    insertion_sort(begin, end, comp);
+}
+
+/**
+ * @return 2 * floor(log2(size)), the number of partitioning rounds after which introsort gives up on quicksort
+ */
+[[nodiscard]] constexpr std::size_t introsort_depth_limit(std::ptrdiff_t size) noexcept {
+    return size <= 1 ? 0 : 2 * (std::bit_width(static_cast<std::size_t>(size)) - 1);
+}
+}  // namespace sort_details
+
+/**
+ * Introsort: quicksort with a median of three (ninther for bigger ranges) pivot, insertion sort for ranges of at most 16 elements and heap sort for any range
+ * that is still being partitioned after 2 * log2(n) levels. O(n log n) in the worst case, O(log n) stack.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void quick_sort(Iterator begin, Iterator end, introsort_t, Compare comp = {}) {
+    sort_details::introsort_loop(begin, end, sort_details::introsort_depth_limit(end - begin), comp);
+    assert(std::is_sorted(begin, end, comp));
+}
+
+/**
+ * Tag that selects the three-way (fat pivot) flavour of `quick_sort`
+ */
+struct three_way_t {
+    explicit three_way_t() = default;
+};
+inline constexpr three_way_t three_way{};
+
+namespace sort_details {
+/**
+ * @param leftmost whether [begin, end) is the leftmost part of the whole range, otherwise std::prev(begin) is the pivot of an earlier round, which is no
+ * bigger than anything in [begin, end)
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void three_way_quick_sort_loop(Iterator begin, Iterator end, std::size_t depth_limit, bool leftmost, Compare& comp) {
+    auto const leaf = leaf_size<Iterator, Compare>();
+    while (end - begin > leaf) {
+        if (depth_limit == 0) {
+            heap_sort_in_place(begin, end, comp);
+            return;
+        }
+        --depth_limit;
+
+        move_pivot_to_last(begin, end, comp);
+
+        // a pivot equal to the earlier pivot in front of the range is the smallest key in the range, and a key we picked twice is likely a frequent one. Only
+        // then the three-way partition pays off, it takes all copies of the key out of the game. Otherwise the much cheaper block partition does the job.
+        if (!leftmost && !comp(*std::prev(begin), *std::prev(end))) {
+            std::iter_swap(begin, std::prev(end));
+            begin = bentley_mcilroy_partition(begin, end, comp).second;
+            continue;
+        }
+
+        auto const pivot_it = partition_pivot_last(begin, end, comp);
+        if (pivot_it - begin < end - pivot_it) {
+            three_way_quick_sort_loop(begin, pivot_it, depth_limit, leftmost, comp);
+            begin = std::next(pivot_it);
+            leftmost = false;
+        } else {
+            three_way_quick_sort_loop(std::next(pivot_it), end, depth_limit, false, comp);
+            end = pivot_it;
+        }
+    }
+    insertion_sort(begin, end, comp);
+}
+}  // namespace sort_details
+
+/**
+ * Introsort with three-way partitioning for duplicate keys, in the way of pdqsort: whenever a pivot turns out equal to the pivot of an earlier round, all
+ * elements equal to it are split off in one three-way (Bentley-McIlroy) partition and never looked at again. A range with k distinct keys sorts in O(n log
+ * k), which is close to linear time for low cardinality keys, while ranges without duplicates run the plain block partitioned introsort.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void quick_sort(Iterator begin, Iterator end, three_way_t, Compare comp = {}) {
+    sort_details::three_way_quick_sort_loop(begin, end, sort_details::introsort_depth_limit(end - begin), true, comp);
+    assert(std::is_sorted(begin, end, comp));
+}
+
+namespace sort_details {
+template <std::random_access_iterator Iterator, typename Compare>
+void introselect_loop(Iterator begin, Iterator nth, Iterator end, std::size_t depth_limit, Compare& comp);
+
+/**
+ * Picks the median of the medians of groups of five as pivot and moves it to prev(end). The pivot is then guaranteed to have at least 30% of the range on
+ * either side, which is what makes selection linear in the worst case. The medians are gathered at the front of the range and their median is selected
+ * recursively, again with median of medians pivots.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void median_of_medians_to_last(Iterator begin, Iterator end, Compare& comp) {
+    auto medians_end = begin;
+    for (auto group = begin; end - group >= 5; group += 5) {
+        insertion_sort(group, group + 5, comp);
+        std::iter_swap(medians_end++, group + 2);
+    }
+    auto const median = begin + (medians_end - begin) / 2;
+    introselect_loop(begin, median, medians_end, 0, comp);
+    std::iter_swap(median, std::prev(end));
+}
+
+/**
+ * Quickselect that only keeps partitioning the side holding `nth`. Pivots are picked like in introsort until `depth_limit` rounds have passed without
+ * reaching `nth`, which random data essentially never takes, from then on median of medians keeps it linear.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void introselect_loop(Iterator begin, Iterator nth, Iterator end, std::size_t depth_limit, Compare& comp) {
+    auto const leaf = leaf_size<Iterator, Compare>();
+    while (end - begin > leaf) {
+        if (depth_limit == 0) {
+            median_of_medians_to_last(begin, end, comp);
+        } else {
+            --depth_limit;
+            move_pivot_to_last(begin, end, comp);
+        }
+
+        auto const pivot_it = partition_pivot_last(begin, end, comp);
+        if (pivot_it == nth) {
+            return;
+        } else if (nth < pivot_it) {
+            end = pivot_it;
+        } else {
+            begin = std::next(pivot_it);
+        }
+    }
+    insertion_sort(begin, end, comp);
+}
+}  // namespace sort_details
+
+/**
+ * Rearranges [begin, end) so that *nth is the element that would be there if the range was sorted, nothing in [begin, nth) is bigger and nothing in (nth,
+ * end) is smaller. Introselect, O(n) in the worst case.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void nth_element(Iterator begin, Iterator nth, Iterator end, Compare comp = {}) {
+    if (nth == end) {
+        return;
+    }
+    sort_details::introselect_loop(begin, nth, end, sort_details::introsort_depth_limit(end - begin), comp);
+}
+
+/**
+ * Moves the k smallest elements of [begin, end) to the front, in no particular order. Pass std::greater<> to get the k biggest instead.
+ * @return the end of the selected elements, std::next(begin, k)
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+Iterator select_k(Iterator begin, Iterator end, std::iter_difference_t<Iterator> k, Compare comp = {}) {
+    auto const middle = begin + std::clamp<std::iter_difference_t<Iterator>>(k, 0, end - begin);
+    if (middle != begin) {
+        // with the (k-1)th element in place, everything in front of it is no bigger
+        nth_element(begin, std::prev(middle), end, comp);
+    }
+    return middle;
+}
+
+/**
+ * Sorts the smallest middle - begin elements of [begin, end) into [begin, middle), the rest ends up in [middle, end) in no particular order. A selection
+ * followed by introsort on the selected elements, O(n + k log k).
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void partial_sort(Iterator begin, Iterator middle, Iterator end, Compare comp = {}) {
+    select_k(begin, end, middle - begin, comp);
+    quick_sort(begin, middle, introsort, comp);
+}
+
+namespace sort_details {
+/**
+ * Ranges at or below this size are not worth a task of their own, sorting them takes about as long as handing them to another thread
+ */
+inline constexpr std::ptrdiff_t parallel_cutoff = 1 << 14;
+
+template <typename Iterator>
+void parallel_quick_sort(Iterator begin, Iterator end, task_group& tasks, std::ptrdiff_t cutoff, std::size_t depth_limit) {
+    std::less<> comp;
+
+    // each round splits off the smaller side as a task that idle workers can steal and keeps partitioning the bigger side on this thread
+    while (end - begin > cutoff && depth_limit != 0) {
+        --depth_limit;
+        move_pivot_to_last(begin, end, comp);
+        auto const pivot_it = partition_pivot_last(begin, end, comp);
+        auto const next_it = std::next(pivot_it);
+
+        if (pivot_it - begin < end - next_it) {
+            tasks.run([begin, pivot_it, &tasks, cutoff, depth_limit] { parallel_quick_sort(begin, pivot_it, tasks, cutoff, depth_limit); });
+            begin = next_it;
+        } else {
+            tasks.run([next_it, end, &tasks, cutoff, depth_limit] { parallel_quick_sort(next_it, end, tasks, cutoff, depth_limit); });
+            end = pivot_it;
+        }
+    }
+    // whatever is left of the depth budget carries over, so a range that keeps getting bad pivots still ends up in heap sort
+    introsort_loop(begin, end, depth_limit, comp);
+}
+}  // namespace sort_details
+
+/**
+ * Parallel quicksort. Sub-partitions bigger than `cutoff` become tasks on `pool`, smaller ones are sorted serially with introsort by whichever thread picked
+ * them up. The calling thread takes part in the sort and returns once the whole range is sorted.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param pool the pool that executes the tasks
+ * @param cutoff ranges at or below this size are sorted serially
+ */
+template <std::random_access_iterator Iterator>
+void quick_sort(Iterator begin, Iterator end, thread_pool& pool, std::ptrdiff_t cutoff = sort_details::parallel_cutoff) {
+    task_group tasks{pool};
+    sort_details::parallel_quick_sort(begin, end, tasks, std::max<std::ptrdiff_t>(cutoff, 1), sort_details::introsort_depth_limit(end - begin));
+    tasks.wait();
+    assert(std::is_sorted(begin, end));
+}
+
+/**
+ * Parallel quicksort on a pool of `thread_count` threads (the calling thread included) that only lives for the duration of the sort
+ */
+template <std::random_access_iterator Iterator>
+void quick_sort(Iterator begin, Iterator end, std::size_t thread_count) {
+    if (thread_count <= 1) {
+        quick_sort(begin, end, introsort);
+        return;
+    }
+    thread_pool pool{thread_count - 1};
+    quick_sort(begin, end, pool);
+}
+
+namespace sort_details {
+/**
+ * Ranges at or below this size are sorted with introsort, sample sort only pays for its extra pass once the input is well past the caches
+ */
+inline constexpr std::ptrdiff_t sample_sort_cutoff = 1 << 16;
+
+/**
+ * At most 2^8 buckets per level: the splitter tree stays in L1 and every bucket's write position stays in the TLB
+ */
+inline constexpr std::size_t max_log_buckets = 8;
+
+/**
+ * @return log2(size / sample_sort_cutoff), the levels it takes to get down to the cutoff if every level only halved the range. A good sample shrinks a
+ * range by far more than that per level, so a range that is still being split once the budget is spent keeps drawing bad samples, and goes to introsort.
+ */
+[[nodiscard]] constexpr std::size_t sample_sort_depth_limit(std::ptrdiff_t size) noexcept {
+    return size <= sample_sort_cutoff ? 0 : static_cast<std::size_t>(std::bit_width(static_cast<std::size_t>(size / sample_sort_cutoff)));
+}
+
+/**
+ * Maps elements to buckets by descending an implicit search tree of splitters (Eytzinger layout, the children of node i are 2i and 2i + 1). The descent
+ * turns every comparison into index arithmetic instead of a branch, and a batch of elements is classified level by level so that their independent
+ * descents overlap in the pipeline. When the sample had duplicate splitters every splitter also gets an equality bucket of its own, elements equal to a
+ * splitter land there and need no further sorting, which is what keeps inputs with few distinct keys from recursing forever.
+ */
+template <typename T, typename Compare>
+class bucket_classifier {
+public:
+    /**
+     * @param splitters sorted and free of duplicates, at least one
+     * @param equality_buckets whether elements equal to a splitter get buckets of their own
+     */
+    bucket_classifier(std::vector<T> const& splitters, bool equality_buckets, Compare& comp)
+        : log_leaves_{static_cast<std::size_t>(std::bit_width(splitters.size()))},
+          leaves_{std::size_t{1} << log_leaves_},
+          equality_buckets_{equality_buckets},
+          tree_(leaves_),
+          lower_(leaves_),
+          comp_{comp} {
+        // pad to a full tree by repeating the largest splitter, the buckets between the copies stay empty
+        std::vector<T> padded(splitters);
+        padded.resize(leaves_ - 1, splitters.back());
+        auto next = padded.begin();
+        fill_tree(1, next);
+
+        lower_[0] = padded.front();
+        std::copy(padded.begin(), padded.end(), lower_.begin() + 1);
+    }
+
+    [[nodiscard]] std::size_t bucket_count() const noexcept { return equality_buckets_ ? 2 * leaves_ - 1 : leaves_; }
+
+    [[nodiscard]] bool is_equality_bucket(std::size_t bucket) const noexcept { return equality_buckets_ && bucket % 2 == 1; }
+
+    /**
+     * Writes the bucket of every element of [first, last) to `out`
+     */
+    template <typename Iterator>
+    void classify(Iterator first, Iterator last, std::uint16_t* out) const {
+        constexpr std::ptrdiff_t batch = 8;
+        for (; last - first >= batch; first += batch, out += batch) {
+            std::array<std::size_t, batch> nodes;
+            nodes.fill(1);
+            for (std::size_t level = 0; level != log_leaves_; ++level) {
+                for (std::ptrdiff_t i = 0; i != batch; ++i) {
+                    nodes[i] = descend(nodes[i], first[i]);
+                }
+            }
+            for (std::ptrdiff_t i = 0; i != batch; ++i) {
+                out[i] = bucket_of(nodes[i], first[i]);
+            }
+        }
+        for (; first != last; ++first, ++out) {
+            std::size_t node = 1;
+            for (std::size_t level = 0; level != log_leaves_; ++level) {
+                node = descend(node, *first);
+            }
+            *out = bucket_of(node, *first);
+        }
+    }
+
+private:
+    void fill_tree(std::size_t node, typename std::vector<T>::iterator& next) {
+        if (node >= leaves_) {
+            return;
+        }
+        fill_tree(2 * node, next);
+        tree_[node] = *next++;
+        fill_tree(2 * node + 1, next);
+    }
+
+    // goes right when the element is no smaller than the splitter, so a leaf counts the splitters <= the element
+    [[nodiscard]] std::size_t descend(std::size_t node, T const& value) const { return 2 * node + static_cast<std::size_t>(!comp_(value, tree_[node])); }
+
+    [[nodiscard]] std::uint16_t bucket_of(std::size_t leaf, T const& value) const {
+        auto const bucket = leaf - leaves_;
+        if (!equality_buckets_) {
+            return static_cast<std::uint16_t>(bucket);
+        }
+        // bucket b holds lower_[b] <= value, it is the equality bucket 2b - 1 when that is no strict inequality. Bucket 0 has no lower splitter.
+        auto const equal = static_cast<std::size_t>(bucket != 0) & static_cast<std::size_t>(!comp_(lower_[bucket], value));
+        return static_cast<std::uint16_t>(2 * bucket - equal);
+    }
+
+    std::size_t log_leaves_;
+    std::size_t leaves_;
+    bool equality_buckets_;
+    std::vector<T> tree_;
+    std::vector<T> lower_;
+    Compare& comp_;
+};
+
+/**
+ * Picks splitters from a random sample that is `oversampling` times bigger than needed, so that the buckets come out about even. The sample is seeded
+ * afresh on every call, so no fixed input makes the buckets come out uneven every time.
+ */
+template <typename Iterator, typename Compare>
+std::pair<std::vector<std::iter_value_t<Iterator>>, bool> sample_splitters(Iterator begin, Iterator end, std::size_t bucket_count, std::size_t oversampling,
+                                                                          Compare& comp) {
+    auto const size = static_cast<std::size_t>(end - begin);
+    std::mt19937_64 rand_engine{std::random_device{}()};
+    std::uniform_int_distribution<std::size_t> distribution{0, size - 1};
+
+    std::vector<std::iter_value_t<Iterator>> samples;
+    samples.reserve(bucket_count * oversampling);
+    for (std::size_t i = 0; i != bucket_count * oversampling; ++i) {
+        samples.push_back(begin[static_cast<std::ptrdiff_t>(distribution(rand_engine))]);
+    }
+    quick_sort(samples.begin(), samples.end(), introsort, comp);
+
+    std::vector<std::iter_value_t<Iterator>> splitters;
+    splitters.reserve(bucket_count - 1);
+    for (std::size_t i = 1; i != bucket_count; ++i) {
+        splitters.push_back(std::move(samples[i * oversampling - 1]));
+    }
+    auto const unique_end = std::unique(splitters.begin(), splitters.end(), [&](auto const& lhs, auto const& rhs) { return !comp(lhs, rhs); });
+    bool const had_duplicates = unique_end != splitters.end();
+    splitters.erase(unique_end, splitters.end());
+    return {std::move(splitters), had_duplicates};
+}
+
+template <typename Iterator, typename Compare>
+void parallel_sample_sort(Iterator begin, Iterator end, task_group& tasks, Compare& comp, std::size_t depth_limit);
+
+/**
+ * One level of sample sort: classify, count, scatter into a buffer, then hand every bucket to a task of its own
+ */
+template <typename Iterator, typename Compare>
+void sample_sort_level(Iterator begin, Iterator end, task_group& tasks, Compare& comp, std::size_t depth_limit) {
+    using value_type = std::iter_value_t<Iterator>;
+    auto const size = end - begin;
+    auto const log_size = static_cast<std::size_t>(std::bit_width(static_cast<std::size_t>(size)) - 1);
+    auto const log_buckets = std::clamp<std::size_t>(log_size - 12, 1, max_log_buckets);
+    auto const oversampling = std::max<std::size_t>(1, log_size / 5);
+
+    auto const [splitters, had_duplicates] = sample_splitters(begin, end, std::size_t{1} << log_buckets, oversampling, comp);
+    bucket_classifier<value_type, Compare> const classifier{splitters, had_duplicates, comp};
+    auto const bucket_count = classifier.bucket_count();
+
+    // one stripe per thread, every thread classifies and scatters its own stripe
+    auto const stripe_count = std::min<std::size_t>(tasks.pool().size() + 1, static_cast<std::size_t>(size / (sample_sort_cutoff / 4)));
+    auto const stripe_begin = [&](std::size_t stripe) { return static_cast<std::ptrdiff_t>(static_cast<std::size_t>(size) * stripe / stripe_count); };
+
+    // overwritten before being read, so neither gets zeroed, and the pages are first touched by the threads that work on them
+    auto const oracle = std::make_unique_for_overwrite<std::uint16_t[]>(static_cast<std::size_t>(size));
+    auto const buffer = std::make_unique_for_overwrite<value_type[]>(static_cast<std::size_t>(size));
+    std::vector<std::size_t> positions(stripe_count * bucket_count);
+
+    for (std::size_t stripe = 0; stripe != stripe_count; ++stripe) {
+        tasks.run([&, stripe] {
+            auto const first = stripe_begin(stripe);
+            auto const last = stripe_begin(stripe + 1);
+            classifier.classify(begin + first, begin + last, oracle.get() + first);
+            auto* const counts = positions.data() + stripe * bucket_count;
+            for (auto i = first; i != last; ++i) {
+                ++counts[oracle[static_cast<std::size_t>(i)]];
+            }
+        });
+    }
+    tasks.wait();
+
+    // exclusive prefix sum in bucket major order: a bucket's slice of every stripe lands next to the other stripes' slices of it
+    std::vector<std::size_t> bucket_begins(bucket_count + 1);
+    std::size_t position = 0;
+    for (std::size_t bucket = 0; bucket != bucket_count; ++bucket) {
+        bucket_begins[bucket] = position;
+        for (std::size_t stripe = 0; stripe != stripe_count; ++stripe) {
+            position += std::exchange(positions[stripe * bucket_count + bucket], position);
+        }
+    }
+    bucket_begins[bucket_count] = position;
+
+    for (std::size_t stripe = 0; stripe != stripe_count; ++stripe) {
+        tasks.run([&, stripe] {
+            auto* const next = positions.data() + stripe * bucket_count;
+            for (auto i = stripe_begin(stripe); i != stripe_begin(stripe + 1); ++i) {
+                buffer[next[oracle[static_cast<std::size_t>(i)]]++] = std::move(begin[i]);
+            }
+        });
+    }
+    tasks.wait();
+
+    // a bucket bigger than a thread's share would leave the other threads idle, those get split up further
+    auto const serial_limit = std::max<std::ptrdiff_t>(sample_sort_cutoff, size / static_cast<std::ptrdiff_t>(stripe_count));
+    for (std::size_t bucket = 0; bucket != bucket_count; ++bucket) {
+        auto const first = static_cast<std::ptrdiff_t>(bucket_begins[bucket]);
+        auto const last = static_cast<std::ptrdiff_t>(bucket_begins[bucket + 1]);
+        if (first == last) {
+            continue;
+        }
+        tasks.run([&, first, last, bucket, depth_limit] {
+            std::move(buffer.get() + first, buffer.get() + last, begin + first);
+            if (classifier.is_equality_bucket(bucket)) {
+                return;
+            }
+            if (last - first > serial_limit) {
+                task_group nested{tasks.pool()};
+                parallel_sample_sort(begin + first, begin + last, nested, comp, depth_limit);
+                nested.wait();
+            } else {
+                quick_sort(begin + first, begin + last, introsort, comp);
+            }
+        });
+    }
+    // the buffer and the classifier have to outlive the bucket tasks
+    tasks.wait();
+}
+
+template <typename Iterator, typename Compare>
+void parallel_sample_sort(Iterator begin, Iterator end, task_group& tasks, Compare& comp, std::size_t depth_limit) {
+    if (end - begin <= sample_sort_cutoff || depth_limit == 0) {
+        quick_sort(begin, end, introsort, comp);
+    } else {
+        sample_sort_level(begin, end, tasks, comp, depth_limit - 1);
+    }
+}
+}  // namespace sort_details
+
+/**
+ * Parallel sample sort in the spirit of IPS4o (Axtmann et al., "In-place Parallel Super Scalar Samplesort"). Splitters for up to 256 buckets are picked from
+ * an oversampled random sample, every thread classifies a stripe of the input with a branchless search tree and scatters it into a buffer, then the buckets
+ * are sorted in parallel, with introsort or, if a bucket is too big for one thread, another level of sample sort. Unlike quicksort every element is moved
+ * only a handful of times in long sequential streams, which is what keeps a sort of a billion elements at the memory bandwidth rather than at the latency.
+ * A bucket that is still too big after sample_sort_depth_limit levels is sorted with introsort, so unlucky samples cannot make the recursion run away.
+ *
+ * Unlike IPS4o, which permutes blocks in place, the scatter goes through a buffer: n elements of extra memory plus two bytes per element for the bucket of
+ * each element. That trades memory for a scatter that is one sequential pass per stripe, without the block permutation and its cleanup of partial blocks.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param pool the pool that executes the tasks, the calling thread takes part as well
+ * @param comp called from several threads at once
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+requires std::default_initializable<std::iter_value_t<Iterator>>
+void sample_sort(Iterator begin, Iterator end, thread_pool& pool, Compare comp = {}) {
+    task_group tasks{pool};
+    sort_details::parallel_sample_sort(begin, end, tasks, comp, sort_details::sample_sort_depth_limit(end - begin));
+    tasks.wait();
+    assert(std::is_sorted(begin, end, comp));
+}
+
+/**
+ * Parallel sample sort on a pool of `thread_count` threads (the calling thread included) that only lives for the duration of the sort
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+requires std::default_initializable<std::iter_value_t<Iterator>>
+void sample_sort(Iterator begin, Iterator end, std::size_t thread_count, Compare comp = {}) {
+    if (thread_count <= 1) {
+        quick_sort(begin, end, introsort, comp);
+        return;
+    }
+    thread_pool pool{thread_count - 1};
+    sample_sort(begin, end, pool, comp);
+}
+
+/**
+ * In-place heap sort: O(n) Floyd heap construction followed by n extractions with a bottom-up sift down. O(n log n) in the worst case and O(1) extra memory.
+ * @tparam Iter must satisfy std::random_access_iterator
+ */
+template <std::random_access_iterator Iter, typename Compare = std::less<>>
+void heap_sort(Iter begin, Iter end, Compare comp = {}) {
+    sort_details::heap_sort_in_place(begin, end, comp);
+    assert(std::is_sorted(begin, end, comp));
+}
+
+namespace sort_details {
+/**
+ * Once one side of a merge wins this many times in a row, the merge switches to galloping
+ */
+inline constexpr std::ptrdiff_t min_gallop = 7;
+
+/**
+ * Exponential search from the front for the partition point of `pred` (true for a prefix of [first, last), false for the rest). Costs O(log d) comparisons
+ * where d is the distance of the partition point from `first`.
+ */
+template <std::random_access_iterator Iterator, typename Predicate>
+Iterator gallop_front(Iterator first, Iterator last, Predicate pred) {
+    auto const size = last - first;
+    std::ptrdiff_t bound = 1;
+    while (bound <= size && pred(first[bound - 1])) {
+        bound *= 2;
+    }
+    return std::partition_point(first + bound / 2, first + std::min(bound, size), pred);
+}
+
+/**
+ * Exponential search from the back for the partition point of `pred`, O(log d) where d is the distance of the partition point from `last`
+ */
+template <std::random_access_iterator Iterator, typename Predicate>
+Iterator gallop_back(Iterator first, Iterator last, Predicate pred) {
+    auto const size = last - first;
+    std::ptrdiff_t bound = 1;
+    while (bound <= size && !pred(last[-bound])) {
+        bound *= 2;
+    }
+    return std::partition_point(last - std::min(bound, size), last - bound / 2, pred);
+}
+
+/**
+ * Merges [first, middle) and [middle, last) by moving the left run, the shorter one, out into `buffer` and merging front to back
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void merge_low(Iterator first, Iterator middle, Iterator last, std::vector<std::iter_value_t<Iterator>>& buffer, Compare& comp) {
+    buffer.assign(std::make_move_iterator(first), std::make_move_iterator(middle));
+    auto left = buffer.begin();
+    auto const left_end = buffer.end();
+    auto right = middle;
+    auto out = first;
+
+    while (left != left_end && right != last) {
+        // one element at a time while the runs interleave finely, ties go left to keep the sort stable
+        std::ptrdiff_t left_wins = 0;
+        std::ptrdiff_t right_wins = 0;
+        while (left != left_end && right != last && left_wins < min_gallop && right_wins < min_gallop) {
+            if (comp(*right, *left)) {
+                *out++ = std::move(*right++);
+                ++right_wins;
+                left_wins = 0;
+            } else {
+                *out++ = std::move(*left++);
+                ++left_wins;
+                right_wins = 0;
+            }
+        }
+
+        // one side keeps winning, so search how far it does and move that whole block at once
+        while (left != left_end && right != last) {
+            auto const left_stop = gallop_front(left, left_end, [&](auto const& x) { return !comp(*right, x); });
+            auto const left_moved = left_stop - left;
+            out = std::move(left, left_stop, out);
+            left = left_stop;
+            if (left == left_end) {
+                break;
+            }
+
+            auto const right_stop = gallop_front(right, last, [&](auto const& x) { return comp(x, *left); });
+            auto const right_moved = right_stop - right;
+            out = std::move(right, right_stop, out);
+            right = right_stop;
+
+            if (left_moved < min_gallop && right_moved < min_gallop) {
+                break;
+            }
+        }
+    }
+    // whatever is left of the right run is already where it belongs
+    std::move(left, left_end, out);
+}
+
+/**
+ * Merges [first, middle) and [middle, last) by moving the right run, the shorter one, out into `buffer` and merging back to front
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void merge_high(Iterator first, Iterator middle, Iterator last, std::vector<std::iter_value_t<Iterator>>& buffer, Compare& comp) {
+    buffer.assign(std::make_move_iterator(middle), std::make_move_iterator(last));
+    auto const right_begin = buffer.begin();
+    auto right = buffer.end();
+    auto left = middle;
+    auto out = last;
+
+    while (left != first && right != right_begin) {
+        // ties go to the right run, which is the one that comes later
+        std::ptrdiff_t left_wins = 0;
+        std::ptrdiff_t right_wins = 0;
+        while (left != first && right != right_begin && left_wins < min_gallop && right_wins < min_gallop) {
+            if (comp(*std::prev(right), *std::prev(left))) {
+                *--out = std::move(*--left);
+                ++left_wins;
+                right_wins = 0;
+            } else {
+                *--out = std::move(*--right);
+                ++right_wins;
+                left_wins = 0;
+            }
+        }
+
+        while (left != first && right != right_begin) {
+            auto const& left_back = *std::prev(left);
+            auto const right_stop = gallop_back(right_begin, right, [&](auto const& x) { return comp(x, left_back); });
+            auto const right_moved = right - right_stop;
+            out = std::move_backward(right_stop, right, out);
+            right = right_stop;
+            if (right == right_begin) {
+                break;
+            }
+
+            auto const& right_back = *std::prev(right);
+            auto const left_stop = gallop_back(first, left, [&](auto const& x) { return !comp(right_back, x); });
+            auto const left_moved = left - left_stop;
+            out = std::move_backward(left_stop, left, out);
+            left = left_stop;
+
+            if (left_moved < min_gallop && right_moved < min_gallop) {
+                break;
+            }
+        }
+    }
+    std::move_backward(right_begin, right, out);
+}
+
+/**
+ * Merges the adjacent sorted runs [first, middle) and [middle, last). The elements at the front of the left run that are no bigger than the right run's first
+ * element and those at the back of the right run that are bigger than the left run's last one are already in place, so only what is in between gets merged,
+ * through the buffer in the direction that moves fewer elements.
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void merge_runs(Iterator first, Iterator middle, Iterator last, std::vector<std::iter_value_t<Iterator>>& buffer, Compare& comp) {
+    first = gallop_front(first, middle, [&](auto const& x) { return !comp(*middle, x); });
+    if (first == middle) {
+        return;
+    }
+    last = gallop_back(middle, last, [&](auto const& x) { return comp(x, *std::prev(middle)); });
+
+    if (middle - first <= last - middle) {
+        merge_low(first, middle, last, buffer, comp);
+    } else {
+        merge_high(first, middle, last, buffer, comp);
+    }
+}
+
+/**
+ * Runs shorter than this are extended with insertion sort. Like Timsort, chosen between 32 and 64 such that n / min_run is close to a power of two.
+ */
+[[nodiscard]] constexpr std::ptrdiff_t min_run_length(std::ptrdiff_t size) noexcept {
+    std::ptrdiff_t low_bits = 0;
+    while (size >= 64) {
+        low_bits |= size & 1;
+        size >>= 1;
+    }
+    return size + low_bits;
+}
+
+/**
+ * Powersort's merge policy: the power of the boundary between the runs [begin_a, begin_b) and [begin_b, end_b) inside a range of `size` elements, which is the
+ * depth at which the boundary would sit in a perfectly balanced merge tree over the range
+ */
+[[nodiscard]] constexpr int node_power(std::ptrdiff_t size, std::ptrdiff_t begin_a, std::ptrdiff_t begin_b, std::ptrdiff_t end_b) noexcept {
+    // the midpoints of both runs as fractions of size, compared bit by bit
+    auto left = static_cast<std::size_t>(begin_a + begin_b);
+    auto right = static_cast<std::size_t>(begin_b + end_b);
+    auto const n = static_cast<std::size_t>(size);
+
+    int common_bits = 0;
+    bool left_digit = left >= n;
+    bool right_digit = right >= n;
+    while (left_digit == right_digit) {
+        ++common_bits;
+        if (left_digit) {
+            left -= n;
+            right -= n;
+        }
+        left <<= 1;
+        right <<= 1;
+        left_digit = left >= n;
+        right_digit = right >= n;
+    }
+    return common_bits + 1;
+}
+
+/**
+ * @return the end of the run starting at `begin`, which is made ascending if it was strictly descending
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+Iterator find_run(Iterator begin, Iterator end, Compare& comp) {
+    auto run_end = std::next(begin);
+    if (run_end == end) {
+        return run_end;
+    }
+    if (comp(*run_end, *begin)) {
+        // only strictly descending runs may be reversed without breaking stability
+        while (std::next(run_end) != end && comp(*std::next(run_end), *run_end)) {
+            ++run_end;
+        }
+        ++run_end;
+        std::reverse(begin, run_end);
+    } else {
+        while (std::next(run_end) != end && !comp(*std::next(run_end), *run_end)) {
+            ++run_end;
+        }
+        ++run_end;
+    }
+    return run_end;
+}
+}  // namespace sort_details
+
+/**
+ * Stable, adaptive merge sort: natural runs (ascending or strictly descending) are detected and short ones are extended to 32-64 elements with insertion
+ * sort, then the runs are merged in the order powersort prescribes, with galloping once one run keeps winning. A sorted range costs n - 1 comparisons, a
+ * range made of r long runs O(n log r).
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param buffer scratch space, at most half the range gets moved into it. Its capacity is kept, so passing the same buffer to repeated calls saves allocating.
+ */
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void merge_sort(Iterator begin, Iterator end, std::vector<std::iter_value_t<Iterator>>& buffer, Compare comp = {}) {
+    struct run {
+        std::ptrdiff_t begin_;
+        std::ptrdiff_t end_;
+        int power_;
+    };
+
+    auto const size = end - begin;
+    if (size < 2) {
+        return;
+    }
+    auto const min_run = sort_details::min_run_length(size);
+    buffer.reserve(static_cast<std::size_t>(size / 2 + 1));
+
+    auto next_run = [&](std::ptrdiff_t from) {
+        auto const natural_end = sort_details::find_run(begin + from, end, comp) - begin;
+        auto const forced_end = std::min(from + min_run, size);
+        if (natural_end < forced_end) {
+            // std::ref keeps this off the sorting networks, which are not stable. That shows for floats, where -0.0 and 0.0 compare equal.
+            insertion_sort(begin + from, begin + forced_end, std::ref(comp));
+            return forced_end;
+        }
+        return natural_end;
+    };
+
+    // the powers on the stack strictly increase and never exceed the bit width of the size, so the stack fits in a fixed array
+    std::array<run, 8 * sizeof(std::size_t) + 1> stack;
+    std::size_t stack_size = 0;
+
+    auto merge_with_top = [&](run& current) {
+        auto const& top = stack[--stack_size];
+        sort_details::merge_runs(begin + top.begin_, begin + current.begin_, begin + current.end_, buffer, comp);
+        current.begin_ = top.begin_;
+    };
+
+    run current{0, next_run(0), 0};
+    while (current.end_ != size) {
+        run const upcoming{current.end_, next_run(current.end_), 0};
+        current.power_ = sort_details::node_power(size, current.begin_, upcoming.begin_, upcoming.end_);
+
+        // every run on the stack whose boundary sits deeper in the merge tree than the new boundary must be merged first
+        while (stack_size != 0 && stack[stack_size - 1].power_ > current.power_) {
+            merge_with_top(current);
+        }
+        assert(stack_size < stack.size());
+        stack[stack_size++] = current;
+        current = upcoming;
+    }
+
+    while (stack_size != 0) {
+        merge_with_top(current);
+    }
+    assert(std::is_sorted(begin, end, comp));
+}
+
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void merge_sort(Iterator begin, Iterator end, Compare comp = {}) {
+    std::vector<std::iter_value_t<Iterator>> buffer;
+    merge_sort(begin, end, buffer, comp);
+}
+
+/**
+ * Key types the radix sorts understand: integers and IEEE-754 floats of up to 64 bits
+ */
+template <typename T>
+concept radix_key = (std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= 8) || (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+namespace sort_details {
+template <typename Iterator, typename Projection>
+using projected_key_t = std::remove_cvref_t<std::invoke_result_t<Projection&, std::iter_reference_t<Iterator>>>;
+
+/**
+ * Maps a key to an unsigned integer of the same width such that comparing the unsigned integers gives the same order as comparing the keys. Signed integers get
+ * their sign bit flipped, floats get their sign bit flipped when positive and all their bits flipped when negative (so -0.0 comes right before 0.0 and NaNs end
+ * up at the very ends).
+ */
+template <radix_key T>
+[[nodiscard]] constexpr auto to_radix(T key) noexcept {
+    using unsigned_type =
+        std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                           std::conditional_t<sizeof(T) == 2, std::uint16_t, std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+    constexpr auto sign_bit = static_cast<unsigned_type>(unsigned_type{1} << (8 * sizeof(T) - 1));
+
+    auto const bits = std::bit_cast<unsigned_type>(key);
+    if constexpr (std::floating_point<T>) {
+        unsigned_type const mask = static_cast<unsigned_type>(-static_cast<unsigned_type>(bits >> (8 * sizeof(T) - 1))) | sign_bit;
+        return static_cast<unsigned_type>(bits ^ mask);
+    } else if constexpr (std::signed_integral<T>) {
+        return static_cast<unsigned_type>(bits ^ sign_bit);
+    } else {
+        return bits;
+    }
+}
+
+template <typename Iterator, typename Projection>
+[[nodiscard]] constexpr std::size_t radix_digit(Iterator it, std::size_t byte, Projection& proj) {
+    return static_cast<std::size_t>((to_radix(std::invoke(proj, *it)) >> (8 * byte)) & 0xFF);
+}
+
+template <typename Projection>
+[[nodiscard]] constexpr auto radix_less(Projection& proj) noexcept {
+    return [&proj](auto const& lhs, auto const& rhs) { return to_radix(std::invoke(proj, lhs)) < to_radix(std::invoke(proj, rhs)); };
+}
+
+/**
+ * Buckets with fewer elements than this are not worth another counting pass, American flag sort hands them to introsort
+ */
+inline constexpr std::ptrdiff_t american_flag_threshold = 256;
+
+template <std::random_access_iterator Iterator, typename Projection>
+void american_flag_sort(Iterator begin, Iterator end, std::size_t byte, Projection& proj) {
+    while (true) {
+        if (end - begin < american_flag_threshold) {
+            quick_sort(begin, end, introsort, radix_less(proj));
+            return;
+        }
+
+        std::array<std::ptrdiff_t, 256> counts{};
+        for (auto it = begin; it != end; ++it) {
+            ++counts[radix_digit(it, byte, proj)];
+        }
+
+        // everything shares this byte, no need to move anything
+        if (std::ranges::find(counts, end - begin) == counts.end()) {
+            std::array<std::ptrdiff_t, 256> heads{};
+            std::array<std::ptrdiff_t, 256> tails{};
+            std::ptrdiff_t offset = 0;
+            for (std::size_t digit = 0; digit != 256; ++digit) {
+                heads[digit] = offset;
+                offset += counts[digit];
+                tails[digit] = offset;
+            }
+
+            // permute in place: keep swapping the element at the head of a bucket to where it belongs until one that belongs here turns up
+            for (std::size_t digit = 0; digit != 256; ++digit) {
+                while (heads[digit] < tails[digit]) {
+                    auto it = begin + heads[digit];
+                    for (auto target = radix_digit(it, byte, proj); target != digit; target = radix_digit(it, byte, proj)) {
+                        std::iter_swap(it, begin + heads[target]++);
+                    }
+                    ++heads[digit];
+                }
+            }
+
+            if (byte != 0) {
+                for (std::size_t digit = 0; digit != 256; ++digit) {
+                    american_flag_sort(begin + (tails[digit] - counts[digit]), begin + tails[digit], byte - 1, proj);
+                }
+            }
+            return;
+        }
+
+        if (byte == 0) {
+            return;
+        }
+        --byte;
+    }
+}
+}  // namespace sort_details
+
+/**
+ * LSD radix sort, one counting pass per byte of the key from least to most significant. The histograms of all bytes are collected in a single sweep up front
+ * and passes over a byte that is the same for every element are skipped, so for example 64-bit keys that only use their lower 20 bits take 3 passes instead
+ * of 8. Stable. Needs a buffer as big as the range.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param proj maps an element to its key, for instance a pointer to an integer member to sort records by that field
+ */
+template <std::random_access_iterator Iterator, typename Projection = std::identity>
+requires radix_key<sort_details::projected_key_t<Iterator, Projection>>
+void radix_sort(Iterator begin, Iterator end, Projection proj = {}) {
+    using key_type = sort_details::projected_key_t<Iterator, Projection>;
+    using value_type = std::iter_value_t<Iterator>;
+    constexpr std::size_t key_bytes = sizeof(key_type);
+
+    auto const size = end - begin;
+    if (size <= sort_details::insertion_sort_threshold) {
+        insertion_sort(begin, end, sort_details::radix_less(proj));
+        return;
+    }
+
+    std::array<std::array<std::ptrdiff_t, 256>, key_bytes> counts{};
+    for (auto it = begin; it != end; ++it) {
+        auto const key = sort_details::to_radix(std::invoke(proj, *it));
+        for (std::size_t byte = 0; byte != key_bytes; ++byte) {
+            ++counts[byte][(key >> (8 * byte)) & 0xFF];
+        }
+    }
+
+    std::array<std::size_t, key_bytes> passes{};
+    std::size_t pass_count = 0;
+    for (std::size_t byte = 0; byte != key_bytes; ++byte) {
+        if (std::ranges::find(counts[byte], size) == counts[byte].end()) {
+            passes[pass_count++] = byte;
+        }
+    }
+    if (pass_count == 0) {
+        return;
+    }
+
+    // ping-pong between the range and the buffer, the first pass reads from the buffer
+    std::vector<value_type> buffer(std::make_move_iterator(begin), std::make_move_iterator(end));
+    bool in_buffer = true;
+
+    for (std::size_t pass = 0; pass != pass_count; ++pass) {
+        auto const byte = passes[pass];
+
+        std::array<std::ptrdiff_t, 256> offsets{};
+        std::exclusive_scan(counts[byte].begin(), counts[byte].end(), offsets.begin(), std::ptrdiff_t{0});
+
+        auto scatter = [&](auto from, auto from_end, auto to) {
+            for (; from != from_end; ++from) {
+                to[offsets[sort_details::radix_digit(from, byte, proj)]++] = std::move(*from);
+            }
+        };
+        if (in_buffer) {
+            scatter(buffer.begin(), buffer.end(), begin);
+        } else {
+            scatter(begin, end, buffer.begin());
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        std::move(buffer.begin(), buffer.end(), begin);
+    }
+    assert(std::is_sorted(begin, end, sort_details::radix_less(proj)));
+}
+
+template <radix_key T>
+void radix_sort(std::vector<T>& vec) {
+    radix_sort(vec.begin(), vec.end());
+}
+
+/**
+ * MSD radix sort in the American flag flavour: starting from the most significant byte, every byte is counted and the range is permuted in place into its 256
+ * buckets, then each bucket is sorted on the next byte. Buckets below 256 elements go to introsort. Not stable, but needs no buffer, which makes it the one
+ * to use for ranges too big to double.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param proj maps an element to its key
+ */
+template <std::random_access_iterator Iterator, typename Projection = std::identity>
+requires radix_key<sort_details::projected_key_t<Iterator, Projection>>
+void msd_radix_sort(Iterator begin, Iterator end, Projection proj = {}) {
+    sort_details::american_flag_sort(begin, end, sizeof(sort_details::projected_key_t<Iterator, Projection>) - 1, proj);
+    assert(std::is_sorted(begin, end, sort_details::radix_less(proj)));
+}
+
+/**
+ * Projections the string sort accepts: the key has to be viewable as a std::string_view that outlives the projection call, so a reference to a string or a
+ * view, but not a string returned by value
+ */
+template <typename Iterator, typename Projection>
+concept string_projection = std::convertible_to<std::invoke_result_t<Projection&, std::iter_reference_t<Iterator>>, std::string_view> &&
+                            (std::is_lvalue_reference_v<std::invoke_result_t<Projection&, std::iter_reference_t<Iterator>>> ||
+                             std::same_as<std::remove_cvref_t<std::invoke_result_t<Projection&, std::iter_reference_t<Iterator>>>, std::string_view>);
+
+namespace sort_details {
+/**
+ * Ranges below this size are insertion sorted on their cached characters
+ */
+inline constexpr std::size_t string_insertion_threshold = 32;
+
+/**
+ * Ranges from this size on take an MSD radix step on one character instead of a multikey quicksort partition, one counting pass beats the log n passes of
+ * partitioning once there are enough strings to fill the 257 buckets
+ */
+inline constexpr std::size_t string_radix_threshold = 1 << 10;
+
+/**
+ * Up to 15 characters of a key from some depth on, packed big endian into two words with the number of characters in the lowest byte. Comparing two of them
+ * orders the keys by those characters, a key that ends there comes before one that goes on, even if it goes on with '\0'. Two equal ones with a count below
+ * 15 belong to equal keys. 15 rather than 7 characters halves the trips to the keys' memory, which are what string sorting spends its time on.
+ */
+struct cached_chars {
+    static constexpr std::size_t capacity = 15;
+
+    std::uint64_t high_ = 0;
+    std::uint64_t low_ = 0;
+
+    [[nodiscard]] static cached_chars of(std::string_view key, std::size_t depth) noexcept {
+        // two word loads when the key is long enough, byte by byte towards its end
+        if (key.size() > depth && key.size() - depth > capacity) {
+            std::array<std::uint64_t, 2> words;
+            std::memcpy(words.data(), key.data() + depth, sizeof(words));
+            return {big_endian(words[0]), (big_endian(words[1]) & ~std::uint64_t{0xFF}) | capacity};
+        }
+
+        auto const count = key.size() > depth ? key.size() - depth : 0;
+        cached_chars chars;
+        chars.low_ = count;
+        for (std::size_t i = 0; i != count; ++i) {
+            auto const c = std::uint64_t{static_cast<unsigned char>(key[depth + i])};
+            if (i < 8) {
+                chars.high_ |= c << (8 * (7 - i));
+            } else {
+                chars.low_ |= c << (8 * (15 - i));
+            }
+        }
+        return chars;
+    }
+
+    [[nodiscard]] constexpr bool ends_key() const noexcept { return (low_ & 0xFF) != capacity; }
+
+    /**
+     * @return 0 when the key ends before `position`, 1 + the character there otherwise
+     */
+    [[nodiscard]] constexpr std::size_t bucket(std::size_t position) const noexcept {
+        if ((low_ & 0xFF) <= position) {
+            return 0;
+        }
+        auto const word = position < 8 ? high_ : low_;
+        return static_cast<std::size_t>((word >> (8 * (7 - position % 8))) & 0xFF) + 1;
+    }
+
+    constexpr auto operator<=>(cached_chars const&) const noexcept = default;
+
+private:
+    [[nodiscard]] static constexpr std::uint64_t big_endian(std::uint64_t word) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            // compilers turn this into a single byte swap instruction
+            word = ((word & 0x00000000FFFFFFFF) << 32) | ((word & 0xFFFFFFFF00000000) >> 32);
+            word = ((word & 0x0000FFFF0000FFFF) << 16) | ((word & 0xFFFF0000FFFF0000) >> 16);
+            word = ((word & 0x00FF00FF00FF00FF) << 8) | ((word & 0xFF00FF00FF00FF00) >> 8);
+        }
+        return word;
+    }
+};
+
+/**
+ * Multikey quicksort with character caching and MSD radix steps, after Kärkkäinen and Rantala, "Engineering Radix Sort for Strings". Sorts views of the keys
+ * along with their positions, the caller applies the resulting permutation to the elements. `cache_[i]` holds the characters of `entries_[i]` from the depth
+ * the range containing i is being sorted on. Radix steps consume the cached characters one at a time, `known` of them are shared by the whole range.
+ */
+class string_sorter {
+public:
+    explicit string_sorter(std::vector<std::string_view> const& keys) : entries_(keys.size()), cache_(keys.size()) {
+        for (std::size_t i = 0; i != keys.size(); ++i) {
+            entries_[i] = {keys[i], i};
+        }
+    }
+
+    /**
+     * @return the original positions of the keys in sorted order
+     */
+    std::vector<std::size_t> sort() {
+        fill_cache(0, entries_.size(), 0);
+        sort(0, entries_.size(), 0, 0);
+
+        std::vector<std::size_t> order(entries_.size());
+        std::ranges::transform(entries_, order.begin(), &entry::position_);
+        return order;
+    }
+
+private:
+    struct entry {
+        std::string_view key_;
+        std::size_t position_;
+    };
+
+    void fill_cache(std::size_t first, std::size_t last, std::size_t depth) noexcept {
+        // the keys are all over the heap, asking for them early overlaps the cache misses
+        constexpr std::size_t prefetch_distance = 16;
+        for (auto i = first; i != last; ++i) {
+#if defined(__GNUC__)
+            if (i + prefetch_distance < last && entries_[i + prefetch_distance].key_.size() > depth) {
+                __builtin_prefetch(entries_[i + prefetch_distance].key_.data() + depth);
+            }
+#endif
+            cache_[i] = cached_chars::of(entries_[i].key_, depth);
+        }
+    }
+
+    void swap(std::size_t lhs, std::size_t rhs) noexcept {
+        std::swap(entries_[lhs], entries_[rhs]);
+        std::swap(cache_[lhs], cache_[rhs]);
+    }
+
+    // sorts a range whose cache holds no characters they all share yet on the characters from `depth` on
+    void sort_deeper(std::size_t first, std::size_t last, std::size_t depth) {
+        fill_cache(first, last, depth);
+        sort(first, last, depth, 0);
+    }
+
+    void sort(std::size_t first, std::size_t last, std::size_t depth, std::size_t known) {
+        while (last - first >= string_insertion_threshold) {
+            if (last - first >= string_radix_threshold) {
+                radix_step(first, last, depth, known);
+                return;
+            }
+
+            // Dijkstra's three-way partition around the median of three
+            auto const middle = first + (last - first) / 2;
+            auto const pivot = std::max(std::min(cache_[first], cache_[middle]), std::min(std::max(cache_[first], cache_[middle]), cache_[last - 1]));
+            auto less_end = first;
+            auto greater_begin = last;
+            for (auto i = first; i != greater_begin;) {
+                if (cache_[i] < pivot) {
+                    swap(less_end++, i++);
+                } else if (pivot < cache_[i]) {
+                    swap(i, --greater_begin);
+                } else {
+                    ++i;
+                }
+            }
+
+            // the keys that agree on all cached characters move on to the next ones, unless they all ended here
+            if (!pivot.ends_key() && greater_begin - less_end > 1) {
+                sort_deeper(less_end, greater_begin, depth + cached_chars::capacity);
+            }
+
+            // recurse into the smaller side and loop on the bigger one
+            if (less_end - first < last - greater_begin) {
+                sort(first, less_end, depth, known);
+                first = greater_begin;
+            } else {
+                sort(greater_begin, last, depth, known);
+                last = less_end;
+            }
+        }
+        insertion_sort(first, last, depth);
+    }
+
+    /**
+     * Distributes [first, last) by the cached character after the `known` ones into 256 buckets, plus one in front for the keys that end before it, and sorts
+     * every bucket on the characters after it. A character all keys share costs one counting pass over the cache and nothing else.
+     */
+    void radix_step(std::size_t first, std::size_t last, std::size_t depth, std::size_t known) {
+        // skip the cached characters all keys share in one go, long common prefixes would otherwise take a counting pass per character
+        known = std::max(known, shared_chars(first, last));
+        if (known == cached_chars::capacity) {
+            sort_deeper(first, last, depth + cached_chars::capacity);
+            return;
+        }
+
+        std::array<std::size_t, 258> offsets{};
+        for (auto i = first; i != last; ++i) {
+            ++offsets[cache_[i].bucket(known) + 1];
+        }
+        if (offsets[1] == last - first) {
+            // all keys ended, they are equal
+            return;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        if (scratch_entries_.empty()) {
+            scratch_entries_.resize(entries_.size());
+            scratch_cache_.resize(cache_.size());
+        }
+        auto next = offsets;
+        for (auto i = first; i != last; ++i) {
+            auto const target = first + next[cache_[i].bucket(known)]++;
+            scratch_entries_[target] = entries_[i];
+            scratch_cache_[target] = cache_[i];
+        }
+        auto const from = static_cast<std::ptrdiff_t>(first);
+        auto const to = static_cast<std::ptrdiff_t>(last);
+        std::copy(scratch_entries_.begin() + from, scratch_entries_.begin() + to, entries_.begin() + from);
+        std::copy(scratch_cache_.begin() + from, scratch_cache_.begin() + to, cache_.begin() + from);
+
+        // bucket 0 holds the keys that ended, they are all equal
+        for (std::size_t bucket = 1; bucket != 257; ++bucket) {
+            auto const bucket_first = first + offsets[bucket];
+            auto const bucket_last = first + offsets[bucket + 1];
+            if (bucket_last - bucket_first < 2) {
+                continue;
+            }
+            if (known + 1 == cached_chars::capacity) {
+                sort_deeper(bucket_first, bucket_last, depth + cached_chars::capacity);
+            } else {
+                sort(bucket_first, bucket_last, depth, known + 1);
+            }
+        }
+    }
+
+    /**
+     * @return how many of the cached characters all keys in [first, last) have in common, counting only characters none of the keys ended before
+     */
+    [[nodiscard]] std::size_t shared_chars(std::size_t first, std::size_t last) const noexcept {
+        std::uint64_t high_difference = 0;
+        std::uint64_t low_difference = 0;
+        std::uint64_t min_count = cached_chars::capacity;
+        for (auto i = first; i != last; ++i) {
+            high_difference |= cache_[i].high_ ^ cache_[first].high_;
+            low_difference |= cache_[i].low_ ^ cache_[first].low_;
+            min_count = std::min(min_count, cache_[i].low_ & 0xFF);
+        }
+        // a difference in the count in the lowest byte stops `same` at 15 at the latest, keys that ended are taken care of by min_count
+        auto const same = high_difference != 0 ? std::countl_zero(high_difference) / 8 : 8 + std::countl_zero(low_difference) / 8;
+        return std::min(static_cast<std::size_t>(same), static_cast<std::size_t>(min_count));
+    }
+
+    void insertion_sort(std::size_t first, std::size_t last, std::size_t depth) noexcept {
+        // the cached characters decide unless they are equal and the keys go on after them
+        auto const less = [&](std::size_t lhs, std::size_t rhs) {
+            if (cache_[lhs] != cache_[rhs]) {
+                return cache_[lhs] < cache_[rhs];
+            }
+            auto const rest = depth + cached_chars::capacity;
+            return !cache_[lhs].ends_key() && entries_[lhs].key_.substr(rest) < entries_[rhs].key_.substr(rest);
+        };
+        for (auto i = first + 1; i < last; ++i) {
+            for (auto j = i; j != first && less(j, j - 1); --j) {
+                swap(j, j - 1);
+            }
+        }
+    }
+
+    std::vector<entry> entries_;
+    std::vector<cached_chars> cache_;
+    // radix steps distribute through these, allocated on the first one
+    std::vector<entry> scratch_entries_;
+    std::vector<cached_chars> scratch_cache_;
+};
+}  // namespace sort_details
+
+/**
+ * Sorts strings, or elements with a string key, without comparing shared prefixes over and over. Bentley and Sedgewick's multikey quicksort partitions on
+ * the characters at the current depth and only moves on to the next ones for the keys that agree on them, large buckets take an MSD radix step on one
+ * character instead. The characters at the current depth are cached next to the keys, 15 at a time, so partitioning scans a sequential array instead of
+ * chasing every key's allocation and each character is read from the keys about once. Keys are ordered like std::string_view's operator<. Not stable, the
+ * elements are moved into their final place once at the end.
+ * @tparam Iterator must satisfy std::random_access_iterator
+ * @param proj maps an element to its key, see `string_projection`
+ */
+template <std::random_access_iterator Iterator, typename Projection = std::identity>
+requires string_projection<Iterator, Projection>
+void string_sort(Iterator begin, Iterator end, Projection proj = {}) {
+    std::vector<std::string_view> keys;
+    keys.reserve(static_cast<std::size_t>(end - begin));
+    for (auto it = begin; it != end; ++it) {
+        keys.emplace_back(std::invoke(proj, *it));
+    }
+    auto const order = sort_details::string_sorter{keys}.sort();
+
+    std::vector<std::iter_value_t<Iterator>> sorted;
+    sorted.reserve(order.size());
+    for (auto const position : order) {
+        sorted.push_back(std::move(begin[static_cast<std::ptrdiff_t>(position)]));
+    }
+    std::ranges::move(sorted, begin);
+    assert(std::is_sorted(begin, end, [&](auto const& lhs, auto const& rhs) {
+        return std::string_view{std::invoke(proj, lhs)} < std::string_view{std::invoke(proj, rhs)};
+    }));
 }
 }  // namespace algo
 #endif  // ALGO_LAND_SORT_H
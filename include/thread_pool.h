@@ -0,0 +1,211 @@
+#ifndef ALGO_LAND_THREAD_POOL_H
+#define ALGO_LAND_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+/**
+ * A fixed size pool of worker threads with work stealing. Every worker owns a deque of tasks, it pushes and pops its own tasks at the back (LIFO, so the most
+ * recently split, cache hot sub problem runs next) and once it runs dry it steals from the front of somebody else's deque, where the oldest and therefore
+ * biggest sub problems of a divide and conquer algorithm sit. Threads that are not part of the pool submit into one extra shared deque.
+ */
+class thread_pool {
+public:
+    using task_type = std::function<void()>;
+
+    explicit thread_pool(std::size_t thread_count = std::max(std::thread::hardware_concurrency(), 1U)) {
+        // one deque per worker plus the shared one at the back for submissions coming from outside the pool
+        for (std::size_t i = 0; i != thread_count + 1; ++i) {
+            queues_.push_back(std::make_unique<task_queue>());
+        }
+        threads_.reserve(thread_count);
+        for (std::size_t i = 0; i != thread_count; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    thread_pool(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard lock{sleep_mutex_};
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Schedules a task. When called from one of the pool's workers the task goes to the back of that worker's own deque.
+     * @param task the task to run, it must not throw
+     */
+    void submit(task_type task) {
+        auto& queue = *queues_[own_queue_index()];
+        {
+            std::lock_guard lock{queue.mutex_};
+            queue.tasks_.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock{sleep_mutex_};
+            ++pending_;
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * Runs a single pending task on the calling thread, if there is one. This lets a thread that waits for its children help out instead of blocking, which
+     * is what makes nested fork-join on a fixed number of threads dead lock free.
+     * @return whether a task was run
+     */
+    bool try_run_one() {
+        if (auto task = take(own_queue_index())) {
+            (*task)();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @return the number of worker threads, not counting threads that help out through `try_run_one`
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return threads_.size(); }
+
+private:
+    struct task_queue {
+        std::mutex mutex_;
+        std::deque<task_type> tasks_;
+    };
+
+    [[nodiscard]] std::size_t own_queue_index() const noexcept { return current_pool_ == this ? current_index_ : threads_.size(); }
+
+    std::optional<task_type> take(std::size_t own_index) {
+        if (pending_.load(std::memory_order_acquire) == 0) {
+            return std::nullopt;
+        }
+
+        // our own deque first, newest task first
+        {
+            auto& queue = *queues_[own_index];
+            std::lock_guard lock{queue.mutex_};
+            if (!queue.tasks_.empty()) {
+                auto task = std::move(queue.tasks_.back());
+                queue.tasks_.pop_back();
+                --pending_;
+                return task;
+            }
+        }
+
+        // then steal the oldest task of somebody else, start with the neighbour so that thieves spread out
+        for (std::size_t offset = 1; offset != queues_.size(); ++offset) {
+            auto& queue = *queues_[(own_index + offset) % queues_.size()];
+            std::lock_guard lock{queue.mutex_};
+            if (!queue.tasks_.empty()) {
+                auto task = std::move(queue.tasks_.front());
+                queue.tasks_.pop_front();
+                --pending_;
+                return task;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void worker_loop(std::size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        while (true) {
+            if (auto task = take(index)) {
+                (*task)();
+                continue;
+            }
+
+            std::unique_lock lock{sleep_mutex_};
+            wake_.wait(lock, [this] { return stop_ || pending_.load() != 0; });
+            if (stop_ && pending_.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    static inline thread_local thread_pool const* current_pool_ = nullptr;
+    static inline thread_local std::size_t current_index_ = 0;
+
+    std::vector<std::unique_ptr<task_queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<std::size_t> pending_ = 0;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+/**
+ * A set of tasks forked onto a `thread_pool` that can be joined as a whole. Waiting never blocks a worker, it keeps running pending tasks until all tasks of
+ * the group are done. The first exception thrown by a task is rethrown from `wait`.
+ */
+class task_group {
+public:
+    explicit task_group(thread_pool& pool) noexcept : pool_{pool} {}
+
+    task_group(task_group const&) = delete;
+    task_group& operator=(task_group const&) = delete;
+
+    ~task_group() { wait_impl(); }
+
+    template <typename F>
+    void run(F&& f) {
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit([this, f = std::forward<F>(f)]() mutable {
+            try {
+                f();
+            } catch (...) {
+                std::lock_guard lock{exception_mutex_};
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+            outstanding_.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    void wait() {
+        wait_impl();
+        if (exception_) {
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+    }
+
+    [[nodiscard]] thread_pool& pool() const noexcept { return pool_; }
+
+private:
+    void wait_impl() noexcept {
+        while (outstanding_.load(std::memory_order_acquire) != 0) {
+            if (!pool_.try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    thread_pool& pool_;
+    std::atomic<std::size_t> outstanding_ = 0;
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+};
+}  // namespace algo
+#endif  // ALGO_LAND_THREAD_POOL_H
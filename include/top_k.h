@@ -0,0 +1,233 @@
+#ifndef ALGO_LAND_TOP_K_H
+#define ALGO_LAND_TOP_K_H
+
+#include <priority_queue.h>
+#include <simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo {
+namespace top_k_details {
+/**
+ * Whether `offer_batch` can compare a whole vector of elements against the threshold at once: plain numbers under the built in orders
+ */
+template <typename T, typename Compare>
+inline constexpr bool simd_prefilter =
+    (std::same_as<T, float> || std::same_as<T, double> || std::same_as<T, std::int32_t> || std::same_as<T, std::int64_t>) &&
+    (std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>> || std::same_as<Compare, std::greater<>> ||
+     std::same_as<Compare, std::greater<T>>);
+
+/**
+ * @return the first position from `pos` on whose element beats `threshold`, greater than it when KeepGreatest and less otherwise, `size` if there is none
+ */
+template <bool KeepGreatest, typename T>
+std::size_t next_candidate_scalar(T const* data, std::size_t pos, std::size_t size, T threshold) noexcept {
+    for (; pos != size; ++pos) {
+        if (KeepGreatest ? threshold < data[pos] : data[pos] < threshold) {
+            return pos;
+        }
+    }
+    return size;
+}
+
+#ifdef ALGO_LAND_SIMD
+// a register worth of elements is compared at once, and only a register with a candidate in it leaves the loop
+template <bool KeepGreatest, typename T>
+[[gnu::target("avx2")]] std::size_t next_candidate_avx2(T const* data, std::size_t pos, std::size_t size, T threshold) noexcept {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    for (; pos + lanes <= size; pos += lanes) {
+        unsigned mask;
+        if constexpr (std::same_as<T, float>) {
+            auto const values = _mm256_loadu_ps(data + pos);
+            auto const broadcast = _mm256_set1_ps(threshold);
+            auto const beats = KeepGreatest ? _mm256_cmp_ps(values, broadcast, _CMP_GT_OQ) : _mm256_cmp_ps(values, broadcast, _CMP_LT_OQ);
+            mask = static_cast<unsigned>(_mm256_movemask_ps(beats));
+        } else if constexpr (std::same_as<T, double>) {
+            auto const values = _mm256_loadu_pd(data + pos);
+            auto const broadcast = _mm256_set1_pd(threshold);
+            auto const beats = KeepGreatest ? _mm256_cmp_pd(values, broadcast, _CMP_GT_OQ) : _mm256_cmp_pd(values, broadcast, _CMP_LT_OQ);
+            mask = static_cast<unsigned>(_mm256_movemask_pd(beats));
+        } else if constexpr (std::same_as<T, std::int32_t>) {
+            auto const values = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + pos));
+            auto const broadcast = _mm256_set1_epi32(threshold);
+            auto const beats = KeepGreatest ? _mm256_cmpgt_epi32(values, broadcast) : _mm256_cmpgt_epi32(broadcast, values);
+            mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(beats)));
+        } else {
+            auto const values = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + pos));
+            auto const broadcast = _mm256_set1_epi64x(threshold);
+            auto const beats = KeepGreatest ? _mm256_cmpgt_epi64(values, broadcast) : _mm256_cmpgt_epi64(broadcast, values);
+            mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(beats)));
+        }
+        if (mask != 0) {
+            return pos + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    return next_candidate_scalar<KeepGreatest>(data, pos, size, threshold);
+}
+
+template <bool KeepGreatest, typename T>
+[[gnu::target("avx512f")]] std::size_t next_candidate_avx512(T const* data, std::size_t pos, std::size_t size, T threshold) noexcept {
+    constexpr std::size_t lanes = 64 / sizeof(T);
+    for (; pos + lanes <= size; pos += lanes) {
+        unsigned mask;
+        if constexpr (std::same_as<T, float>) {
+            auto const values = _mm512_loadu_ps(data + pos);
+            auto const broadcast = _mm512_set1_ps(threshold);
+            mask = KeepGreatest ? _mm512_cmp_ps_mask(values, broadcast, _CMP_GT_OQ) : _mm512_cmp_ps_mask(values, broadcast, _CMP_LT_OQ);
+        } else if constexpr (std::same_as<T, double>) {
+            auto const values = _mm512_loadu_pd(data + pos);
+            auto const broadcast = _mm512_set1_pd(threshold);
+            mask = KeepGreatest ? _mm512_cmp_pd_mask(values, broadcast, _CMP_GT_OQ) : _mm512_cmp_pd_mask(values, broadcast, _CMP_LT_OQ);
+        } else if constexpr (std::same_as<T, std::int32_t>) {
+            auto const values = _mm512_loadu_si512(data + pos);
+            auto const broadcast = _mm512_set1_epi32(threshold);
+            mask = KeepGreatest ? _mm512_cmpgt_epi32_mask(values, broadcast) : _mm512_cmplt_epi32_mask(values, broadcast);
+        } else {
+            auto const values = _mm512_loadu_si512(data + pos);
+            auto const broadcast = _mm512_set1_epi64(threshold);
+            mask = KeepGreatest ? _mm512_cmpgt_epi64_mask(values, broadcast) : _mm512_cmplt_epi64_mask(values, broadcast);
+        }
+        if (mask != 0) {
+            return pos + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    return next_candidate_scalar<KeepGreatest>(data, pos, size, threshold);
+}
+#endif
+}  // namespace top_k_details
+
+/**
+ * Keeps the `capacity` greatest elements under `Compare` of a stream, in a priority_queue whose top is the least of them, the threshold. Once full, an
+ * element that does not beat the threshold is turned away with a single comparison, and one that does replaces the top in a single sink. Over a long stream
+ * almost everything is turned away: the i-th element only gets in with probability capacity / i.
+ *
+ * offer_batch compares a whole vector register of numbers against the threshold at once with AVX2 or AVX-512, and only a register holding a candidate drops
+ * out to the heap.
+ */
+template <typename T, typename Compare = std::less<>>
+class top_k {
+public:
+    using value_type = T;
+
+    /**
+     * @throws std::invalid_argument when `capacity` is 0
+     */
+    explicit top_k(std::size_t capacity, Compare comp = {}, simd_level level = cpu_simd_level())
+        : heap_{reversed{comp}}, capacity_{capacity}, comp_{comp}, level_{level} {
+        if (capacity == 0) {
+            throw std::invalid_argument{"top_k needs room for at least one element!"};
+        }
+        heap_.reserve(capacity);
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return heap_.empty(); }
+    [[nodiscard]] bool full() const noexcept { return heap_.size() == capacity_; }
+    [[nodiscard]] std::size_t size() const noexcept { return heap_.size(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @return the least element kept, which the next one has to beat once full(), may only be called when not empty()
+     */
+    [[nodiscard]] T const& threshold() const noexcept { return heap_.elements().front(); }
+
+    /**
+     * @return whether `u` was kept
+     */
+    template <typename U>
+    requires std::convertible_to<U, T>
+    bool offer(U&& u) {
+        if (full()) [[likely]] {
+            return offer_when_full(std::forward<U>(u));
+        }
+        heap_.insert(std::forward<U>(u));
+        return true;
+    }
+
+    void offer_batch(std::span<T const> batch) {
+        std::size_t pos = 0;
+        for (; pos != batch.size() && !full(); ++pos) {
+            heap_.insert(batch[pos]);
+        }
+        // the whole batch fit, and an empty heap has no threshold to compare against
+        if (!full()) {
+            return;
+        }
+        if constexpr (top_k_details::simd_prefilter<T, Compare>) {
+            constexpr auto keep_greatest = std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>>;
+            auto next_candidate = &top_k_details::next_candidate_scalar<keep_greatest, T>;
+            switch (level_) {
+#ifdef ALGO_LAND_SIMD
+                case simd_level::avx512:
+                    next_candidate = &top_k_details::next_candidate_avx512<keep_greatest, T>;
+                    break;
+                case simd_level::avx2:
+                    next_candidate = &top_k_details::next_candidate_avx2<keep_greatest, T>;
+                    break;
+#endif
+                default:
+                    break;
+            }
+            // the threshold only ever moves up, every candidate is checked against the current one before it goes in
+            while ((pos = next_candidate(batch.data(), pos, batch.size(), threshold())) != batch.size()) {
+                offer_when_full(batch[pos++]);
+            }
+        } else {
+            for (; pos != batch.size(); ++pos) {
+                offer_when_full(batch[pos]);
+            }
+        }
+    }
+
+    /**
+     * Offers everything `other` keeps, for combining the accumulators of several threads. Both are expected to order alike.
+     */
+    void merge(top_k const& other) {
+        // offer_batch would read the elements it is replacing
+        if (this == &other) {
+            return;
+        }
+        offer_batch(other.heap_.elements());
+    }
+
+    /**
+     * @return what is kept, greatest first
+     */
+    [[nodiscard]] std::vector<T> sorted() const {
+        std::vector<T> kept(heap_.elements().begin(), heap_.elements().end());
+        std::sort(kept.begin(), kept.end(), [this](T const& lhs, T const& rhs) { return comp_(rhs, lhs); });
+        return kept;
+    }
+
+private:
+    // the queue keeps its greatest on top, reversed it keeps the least kept element there
+    struct reversed {
+        [[no_unique_address]] Compare comp_;
+        bool operator()(T const& lhs, T const& rhs) const { return comp_(rhs, lhs); }
+    };
+
+    template <typename U>
+    bool offer_when_full(U&& u) {
+        if (!comp_(threshold(), u)) {
+            return false;
+        }
+        heap_.replace_top(std::forward<U>(u));
+        return true;
+    }
+
+    priority_queue<T, reversed> heap_;
+    std::size_t capacity_;
+    [[no_unique_address]] Compare comp_;
+    simd_level level_;
+};
+}  // namespace algo
+#endif  // ALGO_LAND_TOP_K_H
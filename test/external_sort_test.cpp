@@ -0,0 +1,114 @@
+#include <external_sort.h>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace {
+struct record {
+    std::uint64_t key;
+    std::uint32_t sequence;
+    std::uint32_t payload;
+
+    friend auto operator<=>(record const&, record const&) = default;
+};
+
+auto const by_key = [](record const& lhs, record const& rhs) { return lhs.key < rhs.key; };
+
+std::vector<record> random_records(std::size_t size) {
+    std::random_device seeder;
+    std::mt19937_64 rand_engine{seeder()};
+
+    std::vector<record> records(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        records[i] = {rand_engine() % 1000, static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(rand_engine())};
+    }
+    return records;
+}
+
+void write_file(std::filesystem::path const& path, std::vector<record> const& records) {
+    auto file = algo::external_details::open_file(path, "wb");
+    algo::external_details::write_records(file.get(), records.data(), records.size());
+}
+
+std::vector<record> read_file(std::filesystem::path const& path) {
+    std::vector<record> records(std::filesystem::file_size(path) / sizeof(record));
+    auto file = algo::external_details::open_file(path, "rb");
+    algo::external_details::read_records(file.get(), records.data(), records.size());
+    return records;
+}
+
+struct scratch_directory {
+    std::filesystem::path path_ = std::filesystem::temp_directory_path() / ("algo_external_sort_test_" + std::to_string(std::random_device{}()));
+
+    scratch_directory() { std::filesystem::create_directories(path_); }
+    ~scratch_directory() { std::filesystem::remove_all(path_); }
+};
+}  // namespace
+
+TEST_CASE("external_sort sorts files", "[external_sort]") {
+    scratch_directory scratch;
+    auto const input = scratch.path_ / "input";
+    auto const output = scratch.path_ / "output";
+    auto const temp = scratch.path_ / "temp";
+    std::filesystem::create_directories(temp);
+
+    // from a single in memory run over a single merge to several merge passes
+    for (std::size_t memory_limit : {std::size_t{1} << 20, std::size_t{64} << 10, std::size_t{4} << 10}) {
+        for (std::size_t size : {0, 1, 1000, 50000}) {
+            auto const records = random_records(size);
+            write_file(input, records);
+
+            algo::external_sort<record>(input, output, {.memory_limit = memory_limit, .temp_directory = temp}, by_key);
+
+            auto sorted = read_file(output);
+            REQUIRE(std::is_sorted(sorted.begin(), sorted.end(), by_key));
+
+            // same records as before, just in a different order
+            auto expected = records;
+            std::sort(expected.begin(), expected.end());
+            std::sort(sorted.begin(), sorted.end());
+            REQUIRE(sorted == expected);
+            // no run files are left behind
+            REQUIRE(std::filesystem::is_empty(temp));
+        }
+    }
+}
+
+TEST_CASE("external_sort rejects bad input", "[external_sort]") {
+    scratch_directory scratch;
+    auto const input = scratch.path_ / "input";
+    auto const output = scratch.path_ / "output";
+
+    REQUIRE_THROWS(algo::external_sort<record>(scratch.path_ / "does not exist", output));
+
+    write_file(input, random_records(10));
+    std::filesystem::resize_file(input, 10 * sizeof(record) - 1);
+    REQUIRE_THROWS_AS(algo::external_sort<record>(input, output), std::invalid_argument);
+
+    REQUIRE_THROWS_AS(algo::external_sort<record>(input, output, {.memory_limit = sizeof(record)}), std::invalid_argument);
+}
+
+TEST_CASE("external_sort merges a bounded number of runs at once", "[external_sort]") {
+    using algo::external_details::max_merge_fan_in;
+    using algo::external_details::merge_fan_in;
+    // what the memory allows, up to the cap, but never fewer than two
+    REQUIRE(merge_fan_in(1 << 10, 16) == 31);
+    REQUIRE(merge_fan_in(40, 16) == 2);
+    // a 64 GiB budget of 16 byte records in 64 KiB blocks would otherwise open over a million files at once
+    REQUIRE(merge_fan_in(std::size_t{1} << 32, 4096) == max_merge_fan_in);
+
+    // hundreds of tiny runs, merged over several passes
+    scratch_directory scratch;
+    auto const input = scratch.path_ / "input";
+    auto const output = scratch.path_ / "output";
+    auto const records = random_records(200000);
+    write_file(input, records);
+    algo::external_sort<record>(input, output, {.memory_limit = std::size_t{4} << 10, .temp_directory = scratch.path_}, by_key);
+    auto sorted = read_file(output);
+    REQUIRE(std::is_sorted(sorted.begin(), sorted.end(), by_key));
+    REQUIRE(sorted.size() == records.size());
+}
@@ -0,0 +1,64 @@
+#ifndef ALGO_LAND_FIND_BATCH_TEST_H
+#define ALGO_LAND_FIND_BATCH_TEST_H
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * The find_batch checks map_test and rb_map_test share, for any map from int to int
+ */
+template <typename Map>
+void check_find_batch_finds_what_at_finds() {
+    Map map;
+    std::vector<int> keys(1000);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64{7});
+    for (auto key : keys) {
+        // odd keys only, so that half of the lookups miss
+        map.insert({2 * key + 1, key});
+    }
+
+    std::vector<int> lookups(3000);
+    std::mt19937_64 rand_engine{9};
+    std::generate(lookups.begin(), lookups.end(), [&] { return static_cast<int>(rand_engine() % 2100) - 50; });
+
+    for (std::size_t group_size : {1, 3, 16, 5000}) {
+        std::vector<int*> out(lookups.size());
+        map.find_batch(lookups, out, group_size);
+        for (std::size_t i = 0; i != lookups.size(); ++i) {
+            auto const key = lookups[i];
+            if (key > 0 && key < 2000 && key % 2 == 1) {
+                REQUIRE(out[i] != nullptr);
+                REQUIRE(*out[i] == (key - 1) / 2);
+            } else {
+                REQUIRE(out[i] == nullptr);
+            }
+        }
+    }
+
+    auto const& const_map = map;
+    std::vector<int const*> const_out(lookups.size());
+    const_map.find_batch(lookups, const_out);
+    for (std::size_t i = 0; i != lookups.size(); ++i) {
+        REQUIRE(const_out[i] == (const_out[i] ? &map.at(lookups[i]) : nullptr));
+    }
+
+    std::vector<int*> too_short(lookups.size() - 1);
+    REQUIRE_THROWS_AS(map.find_batch(lookups, too_short), std::invalid_argument);
+}
+
+template <typename Map>
+void check_find_batch_on_empty_map() {
+    Map map;
+    std::vector<int> const lookups{1, 2, 3};
+    int stale = 0;
+    std::vector<int*> out(lookups.size(), &stale);
+    map.find_batch(lookups, out);
+    REQUIRE(std::all_of(out.begin(), out.end(), [](int* found) { return found == nullptr; }));
+    map.find_batch({}, out);
+}
+#endif  // ALGO_LAND_FIND_BATCH_TEST_H
@@ -3,12 +3,18 @@
 //
 #include <map.h>
 
+#include "find_batch_test.h"
+
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <set>
+#include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 TEST_CASE("map can construct as <int, int> pair", "[construct]") { algo::map<int, int> m; }
 
@@ -159,4 +165,8 @@ TEST_CASE("map iterators is in non-increasing order", "[iterator]") {
 TEST_CASE("map begin == end when emtpy", "[iterator]") {
     algo::map<int, int> m;
     REQUIRE(m.begin() == m.end());
-}
\ No newline at end of file
+}
+
+TEST_CASE("map::find_batch finds what at finds", "[find_batch]") { check_find_batch_finds_what_at_finds<algo::map<int, int>>(); }
+
+TEST_CASE("map::find_batch on an empty map", "[find_batch]") { check_find_batch_on_empty_map<algo::map<int, int>>(); }
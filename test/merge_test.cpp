@@ -0,0 +1,146 @@
+#include <merge.h>
+
+#include <algorithm>
+#include <bit>
+#include <catch2/catch.hpp>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+std::vector<std::vector<int>> sorted_runs(std::size_t count, std::size_t max_size) {
+    std::mt19937_64 rand_engine{7};
+    std::vector<std::vector<int>> runs(count);
+    for (auto& run : runs) {
+        run.resize(rand_engine() % (max_size + 1));
+        for (auto& i : run) {
+            i = static_cast<int>(rand_engine() % 100);
+        }
+        std::sort(run.begin(), run.end());
+    }
+    return runs;
+}
+
+algo::generator<int> count_up(int from, int to, int step) {
+    for (auto i = from; i < to; i += step) {
+        co_yield i;
+    }
+}
+
+/**
+ * Building the tree plays bit_ceil(k) - 1 matches, after that every element takes ceil(log2 k) of them, one comparison each
+ */
+template <typename T>
+void check_comparisons(std::vector<std::vector<T>> const& runs) {
+    using iterator = typename std::vector<T>::const_iterator;
+    std::vector<std::pair<iterator, iterator>> ranges;
+    std::size_t size = 0;
+    for (auto const& run : runs) {
+        ranges.emplace_back(run.begin(), run.end());
+        size += run.size();
+    }
+    std::size_t comparisons = 0;
+    std::vector<T> merged;
+    algo::k_way_merge(ranges, std::back_inserter(merged), [&](T const& lhs, T const& rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    REQUIRE(std::is_sorted(merged.begin(), merged.end()));
+    auto const levels = static_cast<std::size_t>(std::bit_width(runs.size() - 1));
+    REQUIRE(comparisons <= size * levels + std::bit_ceil(runs.size()) - 1);
+}
+}  // namespace
+
+TEST_CASE("k_way_merge merges sorted ranges", "[k_way_merge]") {
+    // odd k give trees that are not perfect, empty runs exhausted sources from the start
+    for (std::size_t k : {0, 1, 2, 3, 5, 8, 13, 300}) {
+        auto const runs = sorted_runs(k, 50);
+        std::vector<std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>> ranges;
+        std::vector<int> expected;
+        for (auto const& run : runs) {
+            ranges.emplace_back(run.begin(), run.end());
+            expected.insert(expected.end(), run.begin(), run.end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> merged;
+        algo::k_way_merge(ranges, std::back_inserter(merged));
+        REQUIRE(merged == expected);
+    }
+}
+
+TEST_CASE("k_way_merge is stable across sources", "[k_way_merge]") {
+    // pairs of (key, source), the merge compares keys only
+    std::vector<std::vector<std::pair<int, std::size_t>>> runs(7);
+    for (std::size_t source = 0; source != runs.size(); ++source) {
+        for (int key = 0; key < 20; key += static_cast<int>(source % 3) + 1) {
+            runs[source].emplace_back(key, source);
+        }
+    }
+    std::vector<algo::range_source<std::vector<std::pair<int, std::size_t>>::const_iterator>> sources;
+    for (auto const& run : runs) {
+        sources.emplace_back(run.begin(), run.end());
+    }
+
+    std::vector<std::pair<int, std::size_t>> merged;
+    algo::k_way_merge(std::move(sources), std::back_inserter(merged), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+    REQUIRE(std::is_sorted(merged.begin(), merged.end()));
+}
+
+TEST_CASE("k_way_merge makes one comparison per level of the tree", "[k_way_merge]") {
+    // ints have their keys cached, strings are compared straight from the sources
+    for (std::size_t k : {2, 5, 16, 300}) {
+        auto const runs = sorted_runs(k, 200);
+        check_comparisons(runs);
+        std::vector<std::vector<std::string>> strings(runs.size());
+        for (std::size_t i = 0; i != runs.size(); ++i) {
+            std::transform(runs[i].begin(), runs[i].end(), std::back_inserter(strings[i]), [](int value) { return std::to_string(value); });
+            std::sort(strings[i].begin(), strings[i].end());
+        }
+        check_comparisons(strings);
+    }
+}
+
+TEST_CASE("k_way_merge pulls from generators", "[k_way_merge][generator]") {
+    std::vector<algo::generator<int>> sources;
+    sources.push_back(count_up(0, 30, 3));
+    sources.push_back(count_up(1, 30, 3));
+    sources.push_back(count_up(2, 30, 3));
+    sources.push_back(count_up(0, 0, 1));
+
+    std::vector<int> merged;
+    algo::k_way_merge(std::move(sources), std::back_inserter(merged));
+    std::vector<int> expected(30);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(merged == expected);
+}
+
+TEST_CASE("loser trees nest", "[loser_tree]") {
+    std::list<int> const odd{1, 3, 5, 7};
+    std::list<int> const even{0, 2, 4, 6, 8};
+    using list_source = algo::range_source<std::list<int>::const_iterator>;
+
+    std::vector<algo::loser_tree<list_source>> trees;
+    trees.emplace_back(std::vector<list_source>{{odd.begin(), odd.end()}});
+    trees.emplace_back(std::vector<list_source>{{even.begin(), even.end()}, {even.end(), even.end()}});
+
+    std::vector<int> merged;
+    algo::k_way_merge(std::move(trees), std::back_inserter(merged));
+    REQUIRE(merged == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8});
+}
+
+TEST_CASE("generator rethrows what escapes the coroutine", "[generator]") {
+    auto throwing = []() -> algo::generator<int> {
+        co_yield 1;
+        throw std::runtime_error{"broken source"};
+    }();
+    REQUIRE_FALSE(throwing.empty());
+    REQUIRE(throwing.front() == 1);
+    REQUIRE_THROWS_AS(throwing.advance(), std::runtime_error);
+    REQUIRE(throwing.empty());
+}
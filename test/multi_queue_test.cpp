@@ -0,0 +1,109 @@
+#include <multi_queue.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST_CASE("multi_queue with a single shard is an exact priority queue", "[multi_queue]") {
+    algo::multi_queue<int> queue{1, 1};
+    REQUIRE(queue.shard_count() == 1);
+    REQUIRE(queue.empty());
+    REQUIRE(!queue.try_pop());
+
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937_64{1});
+    for (auto const value : values) {
+        queue.insert(value);
+    }
+    REQUIRE(queue.size() == values.size());
+    for (int expected = 999; expected >= 0; --expected) {
+        REQUIRE(queue.try_pop() == expected);
+    }
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("multi_queue pops every element once and close to the top", "[multi_queue]") {
+    algo::multi_queue<int, std::greater<>> queue{4, 2};
+    REQUIRE(queue.shard_count() == 8);
+
+    SECTION("a lone element among many shards is found") {
+        queue.insert(7);
+        REQUIRE(queue.try_pop() == 7);
+        REQUIRE(!queue.try_pop());
+    }
+
+    SECTION("rank error stays small") {
+        constexpr int count = 20000;
+        std::vector<int> values(count);
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), std::mt19937_64{2});
+        for (auto const value : values) {
+            queue.insert(value);
+        }
+
+        // with std::greater the smallest come first, the rank of a pop is how many smaller elements are still queued
+        std::vector<bool> popped(count);
+        std::size_t smaller_left = 0;
+        std::size_t rank_error_sum = 0;
+        int first_left = 0;
+        for (int i = 0; i != count; ++i) {
+            auto const value = queue.try_pop();
+            REQUIRE(value);
+            REQUIRE(!popped[*value]);
+            popped[*value] = true;
+            smaller_left = static_cast<std::size_t>(std::count(popped.begin() + first_left, popped.begin() + *value, false));
+            rank_error_sum += smaller_left;
+            while (first_left != count && popped[first_left]) {
+                ++first_left;
+            }
+        }
+        REQUIRE(!queue.try_pop());
+        // the expected rank error of two-choice pops is about the shard count
+        REQUIRE(static_cast<double>(rank_error_sum) / count < 4.0 * static_cast<double>(queue.shard_count()));
+    }
+}
+
+TEST_CASE("multi_queue loses and duplicates nothing under concurrent pushes and pops", "[multi_queue]") {
+    constexpr std::size_t thread_count = 4;
+    constexpr int per_thread = 20000;
+    algo::multi_queue<int> queue{thread_count};
+
+    std::vector<std::vector<int>> popped(thread_count);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            // every thread pushes its own values and pops about every other push
+            for (int i = 0; i != per_thread; ++i) {
+                queue.insert(static_cast<int>(t) * per_thread + i);
+                if (i % 2 == 1) {
+                    if (auto const value = queue.try_pop()) {
+                        popped[t].push_back(*value);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for (auto const& values : popped) {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    REQUIRE(queue.size() == thread_count * per_thread - all.size());
+    while (auto const value = queue.try_pop()) {
+        all.push_back(*value);
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> expected(thread_count * per_thread);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(all == expected);
+}
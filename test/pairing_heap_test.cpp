@@ -0,0 +1,133 @@
+#include <pairing_heap.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("pairing_heap matches a multiset under inserts, pops and decrease_key", "[pairing_heap]") {
+    algo::pairing_heap<int> heap;
+    // every live handle with its current value
+    std::vector<std::pair<algo::pairing_heap<int>::handle, int>> live;
+    std::multimap<int, std::size_t> expected;
+    std::mt19937_64 rand_engine{5};
+
+    auto const erase_expected = [&](int value) {
+        auto const found = expected.find(value);
+        REQUIRE(found != expected.end());
+        expected.erase(found);
+    };
+    for (int i = 0; i != 30000; ++i) {
+        auto const choice = rand_engine() % 8;
+        if (choice < 4 || live.empty()) {
+            auto const value = static_cast<int>(rand_engine() % 100000);
+            live.emplace_back(heap.insert(value), value);
+            expected.emplace(value, 0);
+        } else if (choice < 6) {
+            auto& [target, value] = live[rand_engine() % live.size()];
+            auto const lower = value - static_cast<int>(rand_engine() % 1000);
+            REQUIRE(heap.value(target) == value);
+            erase_expected(value);
+            heap.decrease_key(target, lower);
+            expected.emplace(lower, 0);
+            value = lower;
+        } else {
+            auto const top_handle = heap.top_handle();
+            auto const top = heap.pop();
+            REQUIRE(top == expected.begin()->first);
+            expected.erase(expected.begin());
+            auto const popped = std::find_if(live.begin(), live.end(), [&](auto const& entry) { return entry.first == top_handle; });
+            REQUIRE(popped != live.end());
+            REQUIRE(popped->second == top);
+            *popped = live.back();
+            live.pop_back();
+        }
+        REQUIRE(heap.size() == expected.size());
+        if (i % 1000 == 0) {
+            REQUIRE(heap.validate());
+        }
+    }
+    while (!heap.empty()) {
+        REQUIRE(heap.pop() == expected.begin()->first);
+        expected.erase(expected.begin());
+    }
+    REQUIRE(expected.empty());
+    REQUIRE_THROWS_AS(heap.pop(), std::out_of_range);
+}
+
+TEST_CASE("pairing_heap melds in place and keeps handles", "[pairing_heap]") {
+    algo::pairing_heap<std::string, std::greater<>> lhs;
+    algo::pairing_heap<std::string, std::greater<>> rhs;
+    lhs.insert("b");
+    auto const c = lhs.insert("c");
+    rhs.insert("d");
+    auto const a = rhs.insert("a");
+    rhs.insert("e");
+
+    lhs.meld(rhs);
+    REQUIRE(rhs.empty());
+    REQUIRE(rhs.size() == 0);
+    REQUIRE(lhs.size() == 5);
+    REQUIRE(lhs.validate());
+    REQUIRE(lhs.value(a) == "a");
+    lhs.decrease_key(a, "z");
+    lhs.decrease_key(c, "y");
+    REQUIRE_THROWS_AS(lhs.decrease_key(c, "b"), std::invalid_argument);
+
+    // the emptied heap is still usable, and melding it back takes the nodes along
+    rhs.insert("x");
+    rhs.meld(lhs);
+    REQUIRE(lhs.empty());
+    std::vector<std::string> popped;
+    while (!rhs.empty()) {
+        popped.push_back(rhs.pop());
+    }
+    REQUIRE(popped == std::vector<std::string>{"z", "y", "x", "e", "d", "b"});
+}
+
+TEST_CASE("pairing_heap melds many heaps and frees what is left", "[pairing_heap]") {
+    std::mt19937_64 rand_engine{8};
+    std::vector<algo::pairing_heap<std::unique_ptr<int>, decltype([](auto const& lhs, auto const& rhs) { return *lhs < *rhs; })>> shards(16);
+    std::vector<int> expected;
+    for (auto& shard : shards) {
+        for (int i = 0; i != 1000; ++i) {
+            auto const value = static_cast<int>(rand_engine() % 1000000);
+            shard.insert(std::make_unique<int>(value));
+            expected.push_back(value);
+        }
+        // a few pops shape each shard like a heap in use
+        for (int i = 0; i != 10; ++i) {
+            auto const popped = shard.pop();
+            expected.erase(std::find(expected.begin(), expected.end(), *popped));
+        }
+    }
+    for (std::size_t i = 1; i != shards.size(); ++i) {
+        shards.front().meld(shards[i]);
+    }
+    auto merged = std::move(shards.front());
+    REQUIRE(merged.size() == expected.size());
+    REQUIRE(merged.validate());
+
+    std::sort(expected.begin(), expected.end());
+    for (std::size_t i = 0; i != expected.size() / 2; ++i) {
+        REQUIRE(*merged.pop() == expected[i]);
+    }
+    // the rest is destroyed with the heap
+}
+
+TEST_CASE("pairing_heap validates a chain a million nodes deep", "[pairing_heap]") {
+    // every insert in descending order becomes the new root with the old one as its only child
+    algo::pairing_heap<int> heap;
+    for (int i = 1 << 20; i != 0; --i) {
+        heap.insert(i);
+    }
+    REQUIRE(heap.validate());
+    REQUIRE(heap.pop() == 1);
+    REQUIRE(heap.validate());
+}
@@ -1,5 +1,382 @@
 #include <priority_queue.h>
 
+#include <algorithm>
 #include <catch2/catch.hpp>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 TEST_CASE("priority queue can construct") { algo::priority_queue<int> heap; }
+
+namespace {
+/**
+ * Interleaves pushes and pops of random values and checks every pop against a sorted copy of what is in the heap
+ */
+template <typename T, typename Compare, std::size_t Arity, typename Make>
+void check_against_sorted(Make make) {
+    algo::priority_queue<T, Compare, Arity> heap;
+    std::vector<T> expected;
+    std::mt19937_64 rand_engine{Arity};
+    auto const pop_and_check = [&] {
+        // the top is the element no other element is greater than, the last one of the sorted copy
+        REQUIRE(heap.top() == expected.back());
+        REQUIRE(heap.pop() == expected.back());
+        expected.pop_back();
+        REQUIRE(heap.validate());
+    };
+
+    for (int i = 0; i != 2000; ++i) {
+        auto value = make(rand_engine() % 500);
+        expected.insert(std::upper_bound(expected.begin(), expected.end(), value, Compare{}), value);
+        heap.insert(std::move(value));
+        if (rand_engine() % 3 == 0) {
+            pop_and_check();
+        }
+    }
+    while (!expected.empty()) {
+        pop_and_check();
+    }
+    REQUIRE(heap.empty());
+    REQUIRE_THROWS_AS(heap.pop(), std::out_of_range);
+}
+
+auto const make_int = [](std::uint64_t value) { return static_cast<int>(value); };
+auto const make_string = [](std::uint64_t value) { return std::string(value % 40, 'x') + std::to_string(value); };
+}  // namespace
+
+TEST_CASE("priority queue pops in order with any arity", "[arity]") {
+    check_against_sorted<int, std::less<>, 2>(make_int);
+    check_against_sorted<int, std::less<>, 3>(make_int);
+    check_against_sorted<int, std::less<>, 4>(make_int);
+    check_against_sorted<int, std::greater<>, 8>(make_int);
+    check_against_sorted<int, std::less<>, 16>(make_int);
+    check_against_sorted<std::string, std::less<>, 2>(make_string);
+    check_against_sorted<std::string, std::greater<>, 4>(make_string);
+    check_against_sorted<std::string, std::less<>, 5>(make_string);
+}
+
+TEST_CASE("priority queue builds from a range in bulk", "[insert_range]") {
+    for (std::size_t size : {0, 1, 2, 5, 1000}) {
+        std::vector<int> values(size);
+        std::mt19937_64 rand_engine{size};
+        std::generate(values.begin(), values.end(), [&] { return static_cast<int>(rand_engine() % 100); });
+        auto sorted = values;
+        std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+
+        algo::priority_queue<int> binary(values.begin(), values.end());
+        algo::priority_queue<int, std::less<>, 4> quaternary(values.begin(), values.end());
+        REQUIRE(binary.size() == size);
+        REQUIRE(binary.validate());
+        REQUIRE(quaternary.validate());
+        for (auto const expected : sorted) {
+            REQUIRE(binary.pop() == expected);
+            REQUIRE(quaternary.pop() == expected);
+        }
+    }
+
+    SECTION("a few elements into a big heap swim, many are heapified") {
+        std::vector<std::string> values;
+        for (int i = 0; i != 500; ++i) {
+            values.push_back(std::to_string(i * 7919 % 1000));
+        }
+        algo::priority_queue<std::string, std::greater<>, 3> heap(values.begin(), values.begin() + 400);
+        heap.insert_range(std::vector<std::string>(values.begin() + 400, values.begin() + 410));
+        REQUIRE(heap.validate());
+        heap.insert_range(std::vector<std::string>(values.begin() + 410, values.end()));
+        REQUIRE(heap.validate());
+        REQUIRE(heap.size() == values.size());
+
+        std::sort(values.begin(), values.end());
+        for (auto const& expected : values) {
+            REQUIRE(heap.pop() == expected);
+        }
+    }
+}
+
+TEST_CASE("priority queue pops in batches", "[pop_n]") {
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937_64{11});
+    algo::priority_queue<int, std::less<>, 4> heap(values.begin(), values.end());
+
+    std::vector<int> popped;
+    // a few off the top by popping, then most of what is left by sorting
+    heap.pop_n(10, std::back_inserter(popped));
+    REQUIRE(heap.validate());
+    heap.pop_n(900, std::back_inserter(popped));
+    REQUIRE(heap.validate());
+    REQUIRE(heap.pop() == 89);
+    heap.insert(5000);
+    heap.pop_n(1000, std::back_inserter(popped));
+    REQUIRE(heap.empty());
+    std::vector<int> none(3);
+    REQUIRE(heap.pop_n(3, none.begin()) == none.begin());
+
+    std::vector<int> expected(1000);
+    std::iota(expected.rbegin(), expected.rend(), 0);
+    expected.erase(expected.begin() + 910);
+    expected.insert(expected.begin() + 910, 5000);
+    REQUIRE(popped == expected);
+}
+
+TEST_CASE("child_aligned_allocator aligns the children of the root", "[arity]") {
+    algo::pq_details::child_aligned_allocator<std::int32_t, 16> allocator;
+    for (std::size_t count : {1, 2, 100}) {
+        auto* memory = allocator.allocate(count);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(memory + 1) % 16 == 0);
+        allocator.deallocate(memory, count);
+    }
+
+    std::vector<std::int64_t, algo::pq_details::heap_allocator<std::int64_t, 8>> vec(100);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(vec.data() + 1) % 64 == 0);
+
+    // a binary heap, the default, keeps the default allocator
+    STATIC_REQUIRE(std::same_as<algo::pq_details::heap_allocator<std::int64_t, 2>, std::allocator<std::int64_t>>);
+    STATIC_REQUIRE(std::same_as<algo::pq_details::heap_allocator<std::int64_t, 4>, algo::pq_details::child_aligned_allocator<std::int64_t, 32>>);
+}
+
+TEST_CASE("indexed_priority_queue matches a map of handles to keys", "[indexed_priority_queue]") {
+    algo::indexed_priority_queue<int> heap;
+    std::map<std::size_t, int> expected;
+    std::mt19937_64 rand_engine{5};
+
+    auto const least = [&] {
+        return std::min_element(expected.begin(), expected.end(), [](auto const& lhs, auto const& rhs) { return lhs.second < rhs.second; });
+    };
+    for (int i = 0; i != 5000; ++i) {
+        auto const handle = static_cast<std::size_t>(rand_engine() % 300);
+        auto const key = static_cast<int>(rand_engine() % 1000);
+        auto const queued = expected.contains(handle);
+        REQUIRE(heap.contains(handle) == queued);
+        switch (rand_engine() % 6) {
+            case 0:
+            case 1:
+                if (queued) {
+                    REQUIRE_THROWS_AS(heap.insert(handle, key), std::invalid_argument);
+                } else {
+                    heap.insert(handle, key);
+                    expected[handle] = key;
+                }
+                break;
+            case 2:
+                if (!queued) {
+                    REQUIRE_THROWS_AS(heap.update(handle, key), std::out_of_range);
+                } else {
+                    heap.update(handle, key);
+                    expected[handle] = key;
+                }
+                break;
+            case 3:
+                if (queued) {
+                    if (key > expected[handle]) {
+                        REQUIRE_THROWS_AS(heap.decrease_key(handle, key), std::invalid_argument);
+                        heap.increase_key(handle, key);
+                    } else {
+                        REQUIRE_THROWS_AS(heap.increase_key(handle, key - 1), std::invalid_argument);
+                        heap.decrease_key(handle, key);
+                    }
+                    expected[handle] = key;
+                }
+                break;
+            case 4:
+                if (!queued) {
+                    REQUIRE_THROWS_AS(heap.erase(handle), std::out_of_range);
+                } else {
+                    heap.erase(handle);
+                    expected.erase(handle);
+                }
+                break;
+            default:
+                if (!expected.empty()) {
+                    auto const [top_handle, top_key] = heap.pop();
+                    REQUIRE(top_key == least()->second);
+                    REQUIRE(expected.at(top_handle) == top_key);
+                    expected.erase(top_handle);
+                }
+        }
+        // the heap only ever holds the live handles
+        REQUIRE(heap.size() == expected.size());
+        REQUIRE(heap.validate());
+        if (!expected.empty()) {
+            REQUIRE(heap.top() == least()->second);
+            REQUIRE(heap.key(heap.top_handle()) == heap.top());
+        }
+    }
+
+    while (!heap.empty()) {
+        heap.pop();
+    }
+    REQUIRE_THROWS_AS(heap.pop(), std::out_of_range);
+}
+
+TEST_CASE("indexed_priority_queue runs Dijkstra", "[indexed_priority_queue]") {
+    // a ring 0 -> 1 -> ... -> 9 -> 0 of weight 1 with a few expensive shortcuts
+    std::vector<std::vector<std::pair<std::size_t, int>>> graph(10);
+    for (std::size_t vertex = 0; vertex != graph.size(); ++vertex) {
+        graph[vertex].emplace_back((vertex + 1) % graph.size(), 1);
+    }
+    graph[0].emplace_back(5, 3);
+    graph[2].emplace_back(9, 10);
+
+    std::vector<int> distances(graph.size(), std::numeric_limits<int>::max());
+    algo::indexed_priority_queue<int, std::less<>, 4> heap;
+    distances[0] = 0;
+    heap.insert(0, 0);
+    while (!heap.empty()) {
+        auto const [vertex, distance] = heap.pop();
+        for (auto const& [next, weight] : graph[vertex]) {
+            if (distance + weight < distances[next]) {
+                distances[next] = distance + weight;
+                heap.contains(next) ? heap.decrease_key(next, distances[next]) : heap.insert(next, distances[next]);
+            }
+        }
+    }
+    REQUIRE(distances == std::vector<int>{0, 1, 2, 3, 4, 3, 4, 5, 6, 7});
+}
+
+namespace {
+/**
+ * Runs the hold model of an event queue on a radix_heap and a sorted copy, each pop is checked against the least key of the copy
+ */
+template <typename Key>
+void check_radix_hold(Key first, std::uint64_t max_delay) {
+    algo::radix_heap<Key> heap;
+    std::multiset<Key> expected;
+    std::mt19937_64 rand_engine{static_cast<std::uint64_t>(max_delay)};
+    for (int i = 0; i != 500; ++i) {
+        auto const key = static_cast<Key>(first + static_cast<Key>(rand_engine() % max_delay));
+        heap.insert(key);
+        expected.insert(key);
+    }
+    for (int i = 0; i != 20000; ++i) {
+        REQUIRE(heap.size() == expected.size());
+        REQUIRE(heap.top() == *expected.begin());
+        auto const now = heap.pop();
+        REQUIRE(now == *expected.begin());
+        expected.erase(expected.begin());
+        // a few pops without a push now and then, so that the heap drains and refills
+        if (i % 7 != 0 || expected.empty()) {
+            auto const next = static_cast<Key>(now + static_cast<Key>(rand_engine() % max_delay));
+            heap.insert(next);
+            expected.insert(next);
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("radix_heap pops like a sorted sequence", "[radix_heap]") {
+    SECTION("unsigned keys") { check_radix_hold<std::uint64_t>(0, 1000); }
+    SECTION("wide delays") { check_radix_hold<std::uint64_t>(0, std::uint64_t{1} << 40); }
+    SECTION("repeated keys") { check_radix_hold<std::uint32_t>(0, 3); }
+    SECTION("negative keys") { check_radix_hold<int>(-1000000, 1000); }
+    SECTION("small keys") { check_radix_hold<std::int16_t>(-30000, 5); }
+}
+
+TEST_CASE("radix_heap takes the key from the element", "[radix_heap]") {
+    struct event {
+        std::int64_t time_;
+        std::string name_;
+    };
+    algo::radix_heap<event, decltype([](event const& e) { return e.time_; })> heap;
+    heap.insert(event{5, "five"});
+    heap.insert(event{-2, "minus two"});
+    heap.insert(event{9, "nine"});
+    REQUIRE(heap.top().name_ == "minus two");
+    REQUIRE(heap.pop().time_ == -2);
+    heap.insert(event{3, "three"});
+    REQUIRE(heap.pop().name_ == "three");
+    REQUIRE(heap.pop().name_ == "five");
+    REQUIRE(heap.pop().name_ == "nine");
+    REQUIRE(heap.empty());
+}
+
+TEST_CASE("radix_heap rejects keys below the last pop", "[radix_heap]") {
+    algo::radix_heap<unsigned> heap;
+    REQUIRE_THROWS_AS(heap.pop(), std::out_of_range);
+    heap.insert(10U);
+    heap.insert(20U);
+    REQUIRE(heap.pop() == 10U);
+    REQUIRE_THROWS_AS(heap.insert(9U), std::invalid_argument);
+    heap.insert(10U);
+    REQUIRE(heap.pop() == 10U);
+    REQUIRE(heap.pop() == 20U);
+    REQUIRE_THROWS_AS(heap.pop(), std::out_of_range);
+}
+
+TEST_CASE("radix_heap top does not raise the floor for inserts", "[radix_heap]") {
+    algo::radix_heap<unsigned> heap;
+    heap.insert(10U);
+    REQUIRE(heap.pop() == 10U);
+    heap.insert(20U);
+    REQUIRE(heap.top() == 20U);
+    // above the last popped key, below the one just looked at
+    heap.insert(15U);
+    REQUIRE(heap.top() == 15U);
+    heap.insert(10U);
+    REQUIRE(heap.pop() == 10U);
+    REQUIRE(heap.pop() == 15U);
+    REQUIRE(heap.pop() == 20U);
+}
+
+TEST_CASE("min_max_heap pops both ends like a multiset", "[min_max_heap]") {
+    algo::min_max_heap<int> heap;
+    std::multiset<int> expected;
+    std::mt19937_64 rand_engine{11};
+    REQUIRE_THROWS_AS(heap.pop_min(), std::out_of_range);
+    REQUIRE_THROWS_AS(heap.pop_max(), std::out_of_range);
+    for (int i = 0; i != 30000; ++i) {
+        auto const choice = rand_engine() % 5;
+        if (choice < 3 || expected.empty()) {
+            auto const value = static_cast<int>(rand_engine() % 1000);
+            heap.insert(value);
+            expected.insert(value);
+        } else if (choice == 3) {
+            REQUIRE(heap.min() == *expected.begin());
+            REQUIRE(heap.pop_min() == *expected.begin());
+            expected.erase(expected.begin());
+        } else {
+            REQUIRE(heap.max() == *expected.rbegin());
+            REQUIRE(heap.pop_max() == *expected.rbegin());
+            expected.erase(std::prev(expected.end()));
+        }
+        REQUIRE(heap.size() == expected.size());
+        if (i % 1000 == 0) {
+            REQUIRE(heap.validate());
+        }
+    }
+}
+
+TEST_CASE("min_max_heap builds from a range in bulk", "[min_max_heap]") {
+    for (std::size_t size : {0, 1, 2, 3, 4, 7, 8, 15, 16, 1000}) {
+        std::vector<std::string> values(size);
+        std::mt19937_64 rand_engine{size};
+        std::generate(values.begin(), values.end(), [&] { return std::to_string(rand_engine() % 100); });
+        algo::min_max_heap<std::string, std::greater<>> heap(values.begin(), values.end());
+        REQUIRE(heap.size() == size);
+        REQUIRE(heap.validate());
+
+        // under std::greater the "least" end is the lexicographically greatest
+        std::sort(values.begin(), values.end());
+        auto low = values.begin();
+        auto high = values.end();
+        for (bool from_max = false; !heap.empty(); from_max = !from_max) {
+            if (from_max) {
+                REQUIRE(heap.pop_max() == *low++);
+            } else {
+                REQUIRE(heap.pop_min() == *--high);
+            }
+        }
+        REQUIRE(low == high);
+    }
+}
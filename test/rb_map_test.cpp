@@ -3,12 +3,18 @@
 //
 #include <balanced_map.h>
 
+#include "find_batch_test.h"
+
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <set>
+#include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 TEST_CASE("map can construct as <int, int> pair", "[construct]") { algo::rb_map<int, int> m; }
 
@@ -56,6 +62,10 @@ TEST_CASE("map can insert", "[insert]") {
     }
 }
 
+TEST_CASE("rb_map::find_batch finds what at finds", "[find_batch]") { check_find_batch_finds_what_at_finds<algo::rb_map<int, int>>(); }
+
+TEST_CASE("rb_map::find_batch on an empty map", "[find_batch]") { check_find_batch_on_empty_map<algo::rb_map<int, int>>(); }
+
 // TEST_CASE("map::min returns the minimum", "[min]") {
 //     algo::rb_map<int, int> map;
 //
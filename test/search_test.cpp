@@ -0,0 +1,208 @@
+#include <search.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+std::vector<int> sorted_ints(std::size_t size) {
+    std::mt19937_64 rand_engine{3};
+    std::vector<int> vec(size);
+    // plenty of duplicates and gaps
+    std::generate(vec.begin(), vec.end(), [&] { return static_cast<int>(rand_engine() % (size + 1)) * 2; });
+    std::sort(vec.begin(), vec.end());
+    return vec;
+}
+}  // namespace
+
+TEST_CASE("lower_bound and upper_bound agree with std", "[lower_bound][upper_bound]") {
+    for (std::size_t size : {0, 1, 2, 3, 7, 8, 100, 1000}) {
+        auto const vec = sorted_ints(size);
+        std::deque<int> const deque(vec.begin(), vec.end());
+        for (int value = -1; value <= static_cast<int>(2 * size + 3); ++value) {
+            REQUIRE(algo::lower_bound(vec.begin(), vec.end(), value) == std::lower_bound(vec.begin(), vec.end(), value));
+            REQUIRE(algo::upper_bound(vec.begin(), vec.end(), value) == std::upper_bound(vec.begin(), vec.end(), value));
+            // random access but not contiguous, nothing is prefetched
+            REQUIRE(algo::lower_bound(deque.begin(), deque.end(), value) == std::lower_bound(deque.begin(), deque.end(), value));
+        }
+    }
+}
+
+TEST_CASE("lower_bound with a custom order", "[lower_bound]") {
+    std::vector<int> const descending{9, 7, 7, 5, 3, 1};
+    REQUIRE(algo::lower_bound(descending.begin(), descending.end(), 7, std::greater<>{}) == descending.begin() + 1);
+    REQUIRE(algo::upper_bound(descending.begin(), descending.end(), 7, std::greater<>{}) == descending.begin() + 3);
+    REQUIRE(algo::lower_bound(descending.begin(), descending.end(), 0, std::greater<>{}) == descending.end());
+}
+
+TEST_CASE("binary_search finds present values only", "[binary_search]") {
+    std::vector<int> const vec{1, 3, 5, 7, 9};
+    for (int value = 0; value != 11; ++value) {
+        auto const found = algo::binary_search(vec.begin(), vec.end(), value);
+        if (value % 2 == 1) {
+            REQUIRE(found != vec.end());
+            REQUIRE(*found == value);
+        } else {
+            REQUIRE(found == vec.end());
+        }
+    }
+}
+
+TEST_CASE("binary_search_batch finds what binary_search finds", "[binary_search]") {
+    for (std::size_t size : {0, 1, 2, 3, 1000}) {
+        auto const vec = sorted_ints(size);
+        std::vector<int> values(2 * size + 3);
+        std::iota(values.begin(), values.end(), -1);
+        std::shuffle(values.begin(), values.end(), std::mt19937_64{size});
+
+        for (std::size_t group_size : {1, 3, 16}) {
+            std::vector<std::vector<int>::const_iterator> out(values.size());
+            algo::binary_search_batch(vec.begin(), vec.end(), values, out, group_size);
+            for (std::size_t i = 0; i != values.size(); ++i) {
+                REQUIRE(out[i] == algo::binary_search(vec.begin(), vec.end(), values[i]));
+            }
+        }
+
+        std::deque<int> const deq(vec.begin(), vec.end());
+        std::vector<std::deque<int>::const_iterator> deq_out(values.size());
+        algo::binary_search_batch(deq.begin(), deq.end(), values, deq_out);
+        for (std::size_t i = 0; i != values.size(); ++i) {
+            REQUIRE(deq_out[i] == algo::binary_search(deq.begin(), deq.end(), values[i]));
+        }
+    }
+
+    std::vector<int> const vec{1, 2, 3};
+    std::vector<std::vector<int>::const_iterator> too_short(2);
+    REQUIRE_THROWS_AS(algo::binary_search_batch(vec.begin(), vec.end(), vec, too_short), std::invalid_argument);
+}
+
+TEST_CASE("exponential_lower_bound agrees with std from every hint", "[exponential_lower_bound]") {
+    for (std::size_t size : {0, 1, 2, 3, 7, 8, 100}) {
+        auto const vec = sorted_ints(size);
+        std::deque<int> const deque(vec.begin(), vec.end());
+        for (int value = -1; value <= static_cast<int>(2 * size + 3); ++value) {
+            auto const expected = std::lower_bound(vec.begin(), vec.end(), value);
+            for (auto hint = vec.begin();; ++hint) {
+                REQUIRE(algo::exponential_lower_bound(vec.begin(), vec.end(), hint, value) == expected);
+                auto const deque_hint = deque.begin() + (hint - vec.begin());
+                REQUIRE(algo::exponential_lower_bound(deque.begin(), deque.end(), deque_hint, value) - deque.begin() == expected - vec.begin());
+                if (hint == vec.end()) {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<int> const descending{9, 7, 7, 5, 3, 1};
+    REQUIRE(algo::exponential_lower_bound(descending.begin(), descending.end(), descending.end(), 7, std::greater<>{}) == descending.begin() + 1);
+    REQUIRE(algo::exponential_lower_bound(descending.begin(), descending.end(), descending.begin(), 0, std::greater<>{}) == descending.end());
+}
+
+TEST_CASE("exponential_search follows a finger through sorted lookups", "[exponential_search]") {
+    auto const vec = sorted_ints(10000);
+    auto finger = vec.begin();
+    for (int value = -1; value <= 20003; value += 3) {
+        auto const found = algo::exponential_search(vec.begin(), vec.end(), finger, value);
+        REQUIRE(found == algo::binary_search(vec.begin(), vec.end(), value));
+        if (found != vec.end()) {
+            finger = found;
+        }
+    }
+}
+
+TEST_CASE("interpolation_lower_bound agrees with std", "[interpolation_lower_bound]") {
+    SECTION("uniform keys") {
+        for (std::size_t size : {0, 1, 2, 16, 17, 100, 10000}) {
+            auto const vec = sorted_ints(size);
+            for (int value = -1; value <= static_cast<int>(2 * size + 3); ++value) {
+                REQUIRE(algo::interpolation_lower_bound(vec.begin(), vec.end(), value) == std::lower_bound(vec.begin(), vec.end(), value));
+                REQUIRE(algo::interpolation_search(vec.begin(), vec.end(), value) == algo::binary_search(vec.begin(), vec.end(), value));
+            }
+        }
+    }
+
+    SECTION("skewed keys and long runs of duplicates") {
+        // interpolation is wildly off on these, the bisection fallback has to keep it correct
+        std::vector<std::int64_t> vec(5000, 0);
+        for (std::size_t i = 0; i != 30; ++i) {
+            vec.push_back(std::int64_t{1} << (i + 20));
+        }
+        vec.resize(vec.size() + 5000, std::numeric_limits<std::int64_t>::max());
+        for (std::int64_t value : {std::numeric_limits<std::int64_t>::min(), std::int64_t{-1}, std::int64_t{0}, std::int64_t{1}, std::int64_t{1} << 20,
+                                   (std::int64_t{1} << 35) + 1, std::int64_t{1} << 49, std::numeric_limits<std::int64_t>::max()}) {
+            REQUIRE(algo::interpolation_lower_bound(vec.begin(), vec.end(), value) == std::lower_bound(vec.begin(), vec.end(), value));
+        }
+    }
+
+    SECTION("floating point keys looked up with integers") {
+        std::vector<double> vec(1000);
+        for (std::size_t i = 0; i != vec.size(); ++i) {
+            vec[i] = static_cast<double>(i * i) / 7;
+        }
+        for (int value = -5; value < 150000; value += 97) {
+            REQUIRE(algo::interpolation_lower_bound(vec.begin(), vec.end(), value) == std::lower_bound(vec.begin(), vec.end(), value));
+        }
+    }
+}
+
+TEST_CASE("eytzinger_array searches like a sorted array", "[eytzinger_array]") {
+    for (std::size_t size : {0, 1, 2, 3, 15, 16, 17, 1000}) {
+        auto const vec = sorted_ints(size);
+        algo::eytzinger_array<int> const eytzinger(vec.begin(), vec.end());
+        REQUIRE(eytzinger.size() == vec.size());
+
+        for (int value = -1; value <= static_cast<int>(2 * size + 3); ++value) {
+            auto const expected_lower = std::lower_bound(vec.begin(), vec.end(), value);
+            auto const lower = eytzinger.lower_bound(value);
+            REQUIRE((lower == eytzinger.end()) == (expected_lower == vec.end()));
+            if (lower != eytzinger.end()) {
+                REQUIRE(*lower == *expected_lower);
+            }
+
+            auto const expected_upper = std::upper_bound(vec.begin(), vec.end(), value);
+            auto const upper = eytzinger.upper_bound(value);
+            REQUIRE((upper == eytzinger.end()) == (expected_upper == vec.end()));
+            if (upper != eytzinger.end()) {
+                REQUIRE(*upper == *expected_upper);
+            }
+
+            REQUIRE(eytzinger.contains(value) == std::binary_search(vec.begin(), vec.end(), value));
+        }
+    }
+}
+
+TEST_CASE("static_search_tree searches like a sorted array", "[static_search_tree]") {
+    using algo::simd_level;
+    auto const level = GENERATE(simd_level::scalar, simd_level::avx2, simd_level::avx512);
+    if (level > algo::cpu_simd_level()) {
+        return;
+    }
+
+    // sizes around a leaf, a full layer of leaves under the root and a third layer
+    for (std::size_t size : {0, 1, 15, 16, 17, 272, 273, 5000}) {
+        auto const vec = sorted_ints(size);
+        algo::static_search_tree const tree(vec.begin(), vec.end(), level);
+        REQUIRE(std::equal(tree.begin(), tree.end(), vec.begin(), vec.end()));
+
+        for (int value = -1; value <= static_cast<int>(2 * size + 3); ++value) {
+            auto const expected = std::lower_bound(vec.begin(), vec.end(), value) - vec.begin();
+            REQUIRE(tree.lower_bound(value) - tree.begin() == expected);
+            REQUIRE(tree.contains(value) == std::binary_search(vec.begin(), vec.end(), value));
+        }
+    }
+
+    SECTION("extreme keys") {
+        std::vector<int> const vec{std::numeric_limits<int>::min(), 0, std::numeric_limits<int>::max(), std::numeric_limits<int>::max()};
+        algo::static_search_tree const tree(vec.begin(), vec.end(), level);
+        REQUIRE(tree.lower_bound(std::numeric_limits<int>::min()) == tree.begin());
+        REQUIRE(tree.lower_bound(1) == tree.begin() + 2);
+        REQUIRE(tree.lower_bound(std::numeric_limits<int>::max()) == tree.begin() + 2);
+    }
+}
@@ -0,0 +1,618 @@
+#include <sort.h>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+std::vector<int> random_ints(std::size_t size, int min = std::numeric_limits<int>::min(), int max = std::numeric_limits<int>::max()) {
+    std::random_device seeder;
+    std::mt19937_64 rand_engine{seeder()};
+    std::uniform_int_distribution<int> distribution{min, max};
+
+    std::vector<int> vec(size);
+    std::generate(vec.begin(), vec.end(), [&] { return distribution(rand_engine); });
+    return vec;
+}
+
+/**
+ * McIlroy's "A Killer Adversary for Quicksort": decides the outcome of comparisons lazily so that every pivot a comparison sort picks turns out to be bad, and
+ * records the input that makes the sort behave that way
+ */
+std::vector<int> quick_sort_killer(std::size_t size) {
+    int const gas = static_cast<int>(size);
+    int solid = 0;
+    int candidate = 0;
+    std::vector<int> values(size, gas);
+    std::vector<int> indices(size);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    algo::quick_sort(indices.begin(), indices.end(), algo::introsort, [&](int lhs, int rhs) {
+        if (values[lhs] == gas && values[rhs] == gas) {
+            values[lhs == candidate ? lhs : rhs] = solid++;
+        }
+        if (values[lhs] == gas) {
+            candidate = lhs;
+        } else if (values[rhs] == gas) {
+            candidate = rhs;
+        }
+        return values[lhs] < values[rhs];
+    });
+    return values;
+}
+}  // namespace
+
+TEST_CASE("quick_sort sorts", "[quick_sort]") {
+    for (std::size_t size : {0, 1, 2, 3, 17, 2000}) {
+        auto vec = random_ints(size, -50, 50);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        algo::quick_sort(vec.begin(), vec.end());
+        REQUIRE(vec == expected);
+    }
+}
+
+TEST_CASE("partition puts the pivot in its final position", "[partition]") {
+    auto check = [](auto begin, auto end) {
+        auto const pivot_it = algo::partition(begin, end);
+        REQUIRE(std::all_of(begin, pivot_it, [&](int i) { return i <= *pivot_it; }));
+        REQUIRE(std::all_of(pivot_it, end, [&](int i) { return i >= *pivot_it; }));
+        return pivot_it;
+    };
+
+    for (std::size_t size : {1, 2, 3, 127, 128, 129, 1000, 5000}) {
+        // random access ranges take the block partition, lists the Hoare partition
+        auto vec = random_ints(size, -100, 100);
+        std::list<int> list(vec.begin(), vec.end());
+        check(vec.begin(), vec.end());
+        check(list.begin(), list.end());
+    }
+
+    SECTION("duplicates split in the middle") {
+        std::vector<int> vec(4096, 1);
+        auto const pivot_it = check(vec.begin(), vec.end());
+        REQUIRE(std::abs(std::distance(vec.begin(), pivot_it) - 2048) < 200);
+    }
+}
+
+TEST_CASE("three_way_partition groups the elements equal to the pivot", "[partition]") {
+    auto check = [](auto begin, auto end) {
+        auto const [equal_begin, equal_end] = algo::three_way_partition(begin, end);
+        REQUIRE(equal_begin != equal_end);
+        auto const pivot = *equal_begin;
+        REQUIRE(std::all_of(begin, equal_begin, [&](int i) { return i < pivot; }));
+        REQUIRE(std::all_of(equal_begin, equal_end, [&](int i) { return i == pivot; }));
+        REQUIRE(std::all_of(equal_end, end, [&](int i) { return i > pivot; }));
+    };
+
+    for (std::size_t size : {1, 2, 3, 100, 5000}) {
+        for (int max : {2, 1000}) {
+            auto vec = random_ints(size, 0, max);
+            std::list<int> list(vec.begin(), vec.end());
+            check(vec.begin(), vec.end());
+            check(list.begin(), list.end());
+        }
+    }
+}
+
+TEST_CASE("quick_sort sorts bidirectional ranges", "[quick_sort]") {
+    auto vec = random_ints(3000, -100, 100);
+    std::list<int> list(vec.begin(), vec.end());
+    std::sort(vec.begin(), vec.end());
+
+    algo::quick_sort(list.begin(), list.end());
+    REQUIRE(std::equal(list.begin(), list.end(), vec.begin(), vec.end()));
+}
+
+TEST_CASE("insertion_sort sorts", "[insertion_sort]") {
+    for (std::size_t size : {0, 1, 2, 3, 17, 200}) {
+        auto vec = random_ints(size, -50, 50);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        algo::insertion_sort(vec);
+        REQUIRE(vec == expected);
+    }
+}
+
+TEST_CASE("introsort sorts", "[quick_sort][introsort]") {
+    std::size_t const size = 5000;
+    std::vector<std::vector<int>> inputs{random_ints(size), random_ints(size, 0, 3), std::vector<int>(size, 7), quick_sort_killer(size)};
+
+    auto& sorted = inputs.emplace_back(size);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    inputs.emplace_back(sorted.rbegin(), sorted.rend());
+    auto& organ_pipe = inputs.emplace_back(sorted);
+    std::reverse(organ_pipe.begin() + size / 2, organ_pipe.end());
+
+    for (auto& vec : inputs) {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        algo::quick_sort(vec.begin(), vec.end(), algo::introsort);
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("with a comparator") {
+        auto vec = random_ints(size);
+        algo::quick_sort(vec.begin(), vec.end(), algo::introsort, std::greater<>{});
+        REQUIRE(std::is_sorted(vec.begin(), vec.end(), std::greater<>{}));
+    }
+}
+
+TEST_CASE("introsort stays O(n log n) on a killer input", "[quick_sort][introsort]") {
+    std::size_t const size = 1 << 14;
+    auto vec = quick_sort_killer(size);
+
+    std::size_t comparisons = 0;
+    algo::quick_sort(vec.begin(), vec.end(), algo::introsort, [&](int lhs, int rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    // a quadratic run would need well over a million comparisons here
+    REQUIRE(comparisons < 8 * size * 14);
+}
+
+TEST_CASE("three-way quick_sort sorts", "[quick_sort][three_way]") {
+    std::size_t const size = 5000;
+    std::vector<std::vector<int>> inputs{random_ints(size), random_ints(size, 0, 3), std::vector<int>(size, 7), quick_sort_killer(size)};
+
+    for (auto& vec : inputs) {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        algo::quick_sort(vec.begin(), vec.end(), algo::three_way);
+        REQUIRE(vec == expected);
+    }
+}
+
+TEST_CASE("three-way quick_sort is close to linear on few distinct keys", "[quick_sort][three_way]") {
+    std::size_t const size = 100000;
+    auto vec = random_ints(size, 0, 3);
+
+    std::size_t comparisons = 0;
+    algo::quick_sort(vec.begin(), vec.end(), algo::three_way, [&](int lhs, int rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    // four keys take about three rounds of two comparisons per element, n log2(n) would be 1.7M
+    REQUIRE(comparisons < 8 * size);
+}
+
+TEST_CASE("heap_sort sorts in place", "[heap_sort]") {
+    for (std::size_t size : {0, 1, 2, 3, 17, 5000}) {
+        for (int max : {3, 1000000}) {
+            auto vec = random_ints(size, 0, max);
+            auto expected = vec;
+            std::sort(expected.begin(), expected.end());
+
+            algo::heap_sort(vec.begin(), vec.end());
+            REQUIRE(vec == expected);
+
+            algo::heap_sort(vec.begin(), vec.end(), std::greater<>{});
+            REQUIRE(std::is_sorted(vec.begin(), vec.end(), std::greater<>{}));
+        }
+    }
+}
+
+TEST_CASE("heap_sort needs about n log2(n) comparisons", "[heap_sort]") {
+    std::size_t const size = 1 << 16;
+    auto vec = random_ints(size);
+
+    std::size_t comparisons = 0;
+    algo::heap_sort(vec.begin(), vec.end(), [&](int lhs, int rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    // the bottom-up sift down gets by with about n log2(n), the textbook one needs about twice as many
+    REQUIRE(comparisons < size * 16 * 5 / 4);
+}
+
+TEST_CASE("merge_sort sorts", "[merge_sort]") {
+    std::size_t const size = 20000;
+    std::vector<std::vector<int>> inputs{random_ints(size), random_ints(size, 0, 3), std::vector<int>(size, 7), random_ints(5), random_ints(100)};
+
+    auto& sorted = inputs.emplace_back(size);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    inputs.emplace_back(sorted.rbegin(), sorted.rend());
+    auto& organ_pipe = inputs.emplace_back(sorted);
+    std::reverse(organ_pipe.begin() + size / 2, organ_pipe.end());
+
+    // long runs with a few elements out of place at the end of each
+    auto& runs = inputs.emplace_back(sorted);
+    for (std::size_t i = 1000; i < size; i += 1000) {
+        std::reverse(runs.begin() + static_cast<std::ptrdiff_t>(i) - 10, runs.begin() + static_cast<std::ptrdiff_t>(i) + 5);
+    }
+
+    std::vector<int> buffer;
+    for (auto& vec : inputs) {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        auto copy = vec;
+        algo::merge_sort(copy.begin(), copy.end());
+        REQUIRE(copy == expected);
+
+        algo::merge_sort(vec.begin(), vec.end(), buffer, std::greater<>{});
+        REQUIRE(std::is_sorted(vec.begin(), vec.end(), std::greater<>{}));
+    }
+}
+
+TEST_CASE("merge_sort is stable", "[merge_sort]") {
+    auto keys = random_ints(50000, 0, 100);
+    std::vector<std::pair<int, std::size_t>> vec;
+    for (std::size_t i = 0; i != keys.size(); ++i) {
+        vec.emplace_back(keys[i], i);
+    }
+    // a few long runs to make sure galloping is exercised
+    std::sort(vec.begin(), vec.begin() + 20000);
+    std::sort(vec.begin() + 20000, vec.begin() + 40000);
+
+    auto expected = vec;
+    std::stable_sort(expected.begin(), expected.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    algo::merge_sort(vec.begin(), vec.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+    REQUIRE(vec == expected);
+}
+
+TEST_CASE("merge_sort is linear on sorted input", "[merge_sort]") {
+    std::vector<int> vec(100000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    std::size_t comparisons = 0;
+    auto counting_less = [&](int lhs, int rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    };
+    algo::merge_sort(vec.begin(), vec.end(), counting_less);
+    // n - 1 to find the run, plus another n - 1 for the is_sorted assertion in debug builds
+    REQUIRE(comparisons <= 2 * (vec.size() - 1));
+
+    comparisons = 0;
+    std::reverse(vec.begin(), vec.end());
+    algo::merge_sort(vec.begin(), vec.end(), counting_less);
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    REQUIRE(comparisons <= 2 * (vec.size() - 1));
+}
+
+TEST_CASE("nth_element puts the nth element in place", "[nth_element]") {
+    for (std::size_t size : {1, 2, 17, 1000, 20000}) {
+        for (int max : {3, std::numeric_limits<int>::max()}) {
+            auto const input = random_ints(size, 0, max);
+            auto sorted = input;
+            std::sort(sorted.begin(), sorted.end());
+
+            for (std::size_t n : {std::size_t{0}, size / 3, size / 2, size - 1}) {
+                auto vec = input;
+                auto const nth = vec.begin() + static_cast<std::ptrdiff_t>(n);
+                algo::nth_element(vec.begin(), nth, vec.end());
+
+                REQUIRE(*nth == sorted[n]);
+                REQUIRE(std::all_of(vec.begin(), nth, [&](int i) { return i <= *nth; }));
+                REQUIRE(std::all_of(nth, vec.end(), [&](int i) { return i >= *nth; }));
+            }
+        }
+    }
+}
+
+TEST_CASE("nth_element stays linear on a killer input", "[nth_element]") {
+    std::size_t const size = 1 << 15;
+    auto vec = quick_sort_killer(size);
+
+    std::size_t comparisons = 0;
+    auto const nth = vec.begin() + static_cast<std::ptrdiff_t>(size / 2);
+    algo::nth_element(vec.begin(), nth, vec.end(), [&](int lhs, int rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    REQUIRE(*nth == static_cast<int>(size / 2));
+    REQUIRE(comparisons < 40 * size);
+}
+
+TEST_CASE("select_k and partial_sort pick the k smallest", "[select_k][partial_sort]") {
+    auto const input = random_ints(10000, -1000, 1000);
+    auto sorted = input;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::ptrdiff_t k : {0, 1, 100, 9999, 10000}) {
+        auto selected = input;
+        auto const selected_end = algo::select_k(selected.begin(), selected.end(), k);
+        REQUIRE(selected_end - selected.begin() == k);
+        std::sort(selected.begin(), selected_end);
+        REQUIRE(std::equal(selected.begin(), selected_end, sorted.begin()));
+
+        auto partially_sorted = input;
+        algo::partial_sort(partially_sorted.begin(), partially_sorted.begin() + k, partially_sorted.end());
+        REQUIRE(std::equal(partially_sorted.begin(), partially_sorted.begin() + k, sorted.begin()));
+    }
+
+    SECTION("the k biggest") {
+        auto vec = input;
+        auto const top_end = algo::select_k(vec.begin(), vec.end(), 100, std::greater<>{});
+        REQUIRE(std::all_of(vec.begin(), top_end, [&](int i) { return i >= sorted[sorted.size() - 100]; }));
+    }
+}
+
+TEMPLATE_TEST_CASE("SIMD kernels sort and partition like the scalar code", "[simd]", int, long, float, double) {
+    using algo::simd_level;
+    std::mt19937_64 rand_engine{7};
+    auto random_keys = [&](std::size_t size, std::int64_t range) {
+        std::vector<TestType> keys(size);
+        for (auto& key : keys) {
+            key = static_cast<TestType>(static_cast<std::int64_t>(rand_engine() % static_cast<std::uint64_t>(range)) - range / 2);
+        }
+        return keys;
+    };
+
+    for (auto level : {simd_level::avx2, simd_level::avx512}) {
+        if (level > algo::cpu_simd_level()) {
+            continue;
+        }
+        INFO("level " << static_cast<int>(level));
+
+        for (std::size_t size = 0; size <= algo::sort_details::simd_network_size; ++size) {
+            for (std::int64_t range : {4, 1000}) {
+                auto keys = random_keys(size, range);
+                auto expected = keys;
+                std::sort(expected.begin(), expected.end());
+                REQUIRE(algo::sort_details::simd_network_sort(keys.data(), keys.size(), level));
+                REQUIRE(keys == expected);
+            }
+        }
+
+        for (std::size_t size : {1, 7, 8, 16, 17, 33, 64, 100, 1000, 4099}) {
+            for (std::int64_t range : {4, 1000}) {
+                auto keys = random_keys(size, range);
+                auto const pivot = keys[size / 2];
+                auto expected = keys;
+                std::sort(expected.begin(), expected.end());
+                if (auto const left_size = algo::sort_details::simd_partition(keys.data(), keys.size(), pivot, level)) {
+                    REQUIRE(std::all_of(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(*left_size), [&](auto key) { return !(pivot < key); }));
+                    REQUIRE(std::all_of(keys.begin() + static_cast<std::ptrdiff_t>(*left_size), keys.end(), [&](auto key) { return !(key < pivot); }));
+                    std::sort(keys.begin(), keys.end());
+                    REQUIRE(keys == expected);
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("sorts keep NaN keys", "[simd][quick_sort][nth_element]", float, double) {
+    auto const nan = std::numeric_limits<TestType>::quiet_NaN();
+    // what is left besides the NaNs, in order, and how many NaNs there are
+    auto const keys_of = [](std::vector<TestType> keys) {
+        auto const nans = std::count_if(keys.begin(), keys.end(), [](TestType key) { return std::isnan(key); });
+        keys.erase(std::remove_if(keys.begin(), keys.end(), [](TestType key) { return std::isnan(key); }), keys.end());
+        std::sort(keys.begin(), keys.end());
+        return std::pair{keys, nans};
+    };
+
+    std::mt19937_64 rand_engine{13};
+    std::vector<std::vector<TestType>> inputs{{nan}, {3, nan, 1, 2}, {nan, 5}, {nan, nan, nan}};
+    for (std::size_t size : {17, 64, 65, 1000}) {
+        auto& keys = inputs.emplace_back(size);
+        for (auto& key : keys) {
+            key = rand_engine() % 8 == 0 ? nan : static_cast<TestType>(rand_engine() % 100);
+        }
+    }
+
+    for (auto const& input : inputs) {
+        auto const expected = keys_of(input);
+        auto keys = input;
+        algo::insertion_sort(keys.begin(), keys.end());
+        REQUIRE(keys_of(keys) == expected);
+
+        keys = input;
+        algo::quick_sort(keys.begin(), keys.end(), algo::introsort);
+        REQUIRE(keys_of(keys) == expected);
+
+        keys = input;
+        algo::nth_element(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(keys.size() / 2), keys.end());
+        REQUIRE(keys_of(keys) == expected);
+    }
+}
+
+TEST_CASE("parallel quick_sort sorts", "[quick_sort][parallel]") {
+    auto vec = random_ints(200000);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end());
+
+    SECTION("on a given pool") {
+        algo::thread_pool pool{3};
+        algo::quick_sort(vec.begin(), vec.end(), pool, 512);
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("with a thread count") {
+        for (std::size_t thread_count : {1, 2, 4}) {
+            auto copy = vec;
+            algo::quick_sort(copy.begin(), copy.end(), thread_count);
+            REQUIRE(copy == expected);
+        }
+    }
+}
+
+TEST_CASE("sample_sort sorts", "[sample_sort][parallel]") {
+    auto check = [](auto vec, auto comp) {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end(), comp);
+        for (std::size_t thread_count : {1, 2, 4}) {
+            auto copy = vec;
+            algo::sample_sort(copy.begin(), copy.end(), thread_count, comp);
+            REQUIRE(copy == expected);
+        }
+    };
+
+    SECTION("random") { check(random_ints(300000), std::less<>{}); }
+    SECTION("descending") { check(random_ints(300000, 0, 1000000), std::greater<>{}); }
+    SECTION("few distinct keys") { check(random_ints(300000, 0, 3), std::less<>{}); }
+    SECTION("all equal") { check(std::vector<int>(300000, 7), std::less<>{}); }
+    SECTION("sorted") {
+        std::vector<int> sorted(300000);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        check(sorted, std::less<>{});
+    }
+    SECTION("below the cutoff") { check(random_ints(1000, 0, 100), std::less<>{}); }
+
+    SECTION("on a given pool") {
+        auto vec = random_ints(300000, 0, 1 << 20);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+        algo::thread_pool pool{3};
+        algo::sample_sort(vec.begin(), vec.end(), pool);
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("out of depth budget") {
+        // one level of sample sort, then every bucket goes to introsort however big it is
+        auto vec = random_ints(300000, 0, 1 << 20);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+        algo::thread_pool pool{3};
+        algo::task_group tasks{pool};
+        std::less<> comp;
+        algo::sort_details::parallel_sample_sort(vec.begin(), vec.end(), tasks, comp, 1);
+        tasks.wait();
+        REQUIRE(vec == expected);
+        REQUIRE(algo::sort_details::sample_sort_depth_limit(algo::sort_details::sample_sort_cutoff) == 0);
+        REQUIRE(algo::sort_details::sample_sort_depth_limit(std::ptrdiff_t{1} << 30) == 15);
+    }
+}
+
+TEST_CASE("radix sorts order keys like operator<", "[radix_sort]") {
+    auto check = [](auto vec) {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        auto lsd = vec;
+        algo::radix_sort(lsd.begin(), lsd.end());
+        REQUIRE(lsd == expected);
+
+        auto msd = vec;
+        algo::msd_radix_sort(msd.begin(), msd.end());
+        REQUIRE(msd == expected);
+    };
+
+    std::mt19937_64 rand_engine{std::random_device{}()};
+    for (std::size_t size : {0, 1, 5, 300, 20000}) {
+        std::vector<std::int64_t> int64s(size);
+        std::vector<std::uint32_t> small_uint32s(size);
+        std::vector<std::int8_t> int8s(size);
+        std::vector<double> doubles(size);
+        std::vector<float> floats(size);
+        for (std::size_t i = 0; i != size; ++i) {
+            int64s[i] = static_cast<std::int64_t>(rand_engine());
+            small_uint32s[i] = static_cast<std::uint32_t>(rand_engine() % 1000);
+            int8s[i] = static_cast<std::int8_t>(rand_engine());
+            doubles[i] = std::uniform_real_distribution<double>{-1e6, 1e6}(rand_engine);
+            floats[i] = std::uniform_real_distribution<float>{-10, 10}(rand_engine);
+        }
+        check(int64s);
+        check(small_uint32s);
+        check(int8s);
+        check(doubles);
+        check(floats);
+        check(random_ints(size, -3, 3));
+    }
+
+    check(std::vector<double>{0.0, -1.5, std::numeric_limits<double>::infinity(), 2.25, -std::numeric_limits<double>::infinity(), -0.5, 1e-300});
+}
+
+TEST_CASE("radix sorts sort records through a projection", "[radix_sort]") {
+    struct record {
+        std::int32_t id;
+        int payload;
+    };
+
+    std::vector<record> records;
+    for (int i = 0; i != 5000; ++i) {
+        records.push_back({(i * 7919) % 1000 - 500, i});
+    }
+
+    auto by_id = [](record const& lhs, record const& rhs) { return lhs.id < rhs.id; };
+
+    auto lsd = records;
+    algo::radix_sort(lsd.begin(), lsd.end(), &record::id);
+    REQUIRE(std::is_sorted(lsd.begin(), lsd.end(), by_id));
+    // LSD radix sort is stable
+    for (std::size_t i = 1; i != lsd.size(); ++i) {
+        if (lsd[i - 1].id == lsd[i].id) {
+            REQUIRE(lsd[i - 1].payload < lsd[i].payload);
+        }
+    }
+
+    auto msd = records;
+    algo::msd_radix_sort(msd.begin(), msd.end(), &record::id);
+    REQUIRE(std::is_sorted(msd.begin(), msd.end(), by_id));
+}
+
+TEST_CASE("string_sort orders like std::string", "[string_sort]") {
+    std::mt19937_64 rand_engine{11};
+    auto random_string = [&](std::string prefix, std::size_t max_length, std::string_view alphabet) {
+        auto const length = rand_engine() % (max_length + 1);
+        for (std::size_t i = 0; i != length; ++i) {
+            prefix.push_back(alphabet[rand_engine() % alphabet.size()]);
+        }
+        return prefix;
+    };
+    auto check = [](std::vector<std::string> strings) {
+        auto expected = strings;
+        std::sort(expected.begin(), expected.end());
+        algo::string_sort(strings.begin(), strings.end());
+        REQUIRE(strings == expected);
+    };
+
+    SECTION("empty and tiny") {
+        check({});
+        check({"b", "a"});
+        check({"", "a", "", "ab", "a"});
+    }
+
+    // sizes on both sides of the insertion sort and the radix thresholds
+    for (std::size_t size : {20, 500, 5000, 50000}) {
+        SECTION("long shared prefixes, " + std::to_string(size)) {
+            std::vector<std::string> strings;
+            for (std::size_t i = 0; i != size; ++i) {
+                strings.push_back(random_string(i % 3 == 0 ? "https://www.example.com/a/very/long/path/" : "https://www.example.com/", 12, "abc/-"));
+            }
+            check(strings);
+        }
+        SECTION("embedded nulls and high characters, " + std::to_string(size)) {
+            std::vector<std::string> strings;
+            for (std::size_t i = 0; i != size; ++i) {
+                strings.push_back(random_string("", 20, std::string_view{"a\0\xff\x80", 4}));
+            }
+            check(strings);
+        }
+        SECTION("many duplicates, " + std::to_string(size)) {
+            std::vector<std::string> strings;
+            for (std::size_t i = 0; i != size; ++i) {
+                strings.push_back(std::string(rand_engine() % 40, 'x'));
+            }
+            check(strings);
+        }
+    }
+}
+
+TEST_CASE("string_sort sorts by a projected key", "[string_sort]") {
+    struct record {
+        std::string name_;
+        int id_;
+    };
+    std::vector<record> records{{"carol", 3}, {"alice", 1}, {"dave", 4}, {"bob", 2}};
+    algo::string_sort(records.begin(), records.end(), &record::name_);
+    for (std::size_t i = 0; i != records.size(); ++i) {
+        REQUIRE(records[i].id_ == static_cast<int>(i) + 1);
+    }
+}
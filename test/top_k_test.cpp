@@ -0,0 +1,110 @@
+#include <top_k.h>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<T> random_values(std::size_t size, std::uint64_t seed) {
+    std::mt19937_64 rand_engine{seed};
+    std::vector<T> values(size);
+    // a narrow range, so that there are plenty of ties with the threshold
+    std::generate(values.begin(), values.end(), [&] { return static_cast<T>(static_cast<std::int64_t>(rand_engine() % 20000) - 10000); });
+    return values;
+}
+
+template <typename T, typename Compare>
+std::vector<T> expected_top(std::vector<T> values, std::size_t k, Compare comp) {
+    std::sort(values.begin(), values.end(), [&](T const& lhs, T const& rhs) { return comp(rhs, lhs); });
+    values.resize(std::min(k, values.size()));
+    return values;
+}
+
+template <typename T, typename Compare>
+void check_top_k(Compare comp) {
+    using algo::simd_level;
+    auto const level = GENERATE(simd_level::scalar, simd_level::avx2, simd_level::avx512);
+    if (level > algo::cpu_simd_level()) {
+        return;
+    }
+    // batches shorter than a register, and long ones with an odd tail
+    for (std::size_t size : {0, 1, 5, 100, 100003}) {
+        auto const values = random_values<T>(size, size);
+        for (std::size_t k : {1, 7, 64, 1000}) {
+            algo::top_k<T, Compare> one_by_one(k, comp, level);
+            for (auto const value : values) {
+                one_by_one.offer(value);
+            }
+            algo::top_k<T, Compare> batched(k, comp, level);
+            batched.offer_batch(values);
+
+            auto const expected = expected_top(values, k, comp);
+            REQUIRE(one_by_one.sorted() == expected);
+            REQUIRE(batched.sorted() == expected);
+            REQUIRE(batched.size() == expected.size());
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("top_k keeps the greatest of a stream", "[top_k]") {
+    SECTION("float") { check_top_k<float>(std::less<>{}); }
+    SECTION("double, least first") { check_top_k<double>(std::greater<>{}); }
+    SECTION("int32") { check_top_k<std::int32_t>(std::less<std::int32_t>{}); }
+    SECTION("int64, least first") { check_top_k<std::int64_t>(std::greater<std::int64_t>{}); }
+    SECTION("no SIMD for other types") { check_top_k<std::int16_t>(std::less<>{}); }
+}
+
+TEST_CASE("top_k rejects what does not beat the threshold", "[top_k]") {
+    algo::top_k<std::string> top{2};
+    REQUIRE(top.empty());
+    REQUIRE(top.offer("b"));
+    REQUIRE(top.offer("d"));
+    REQUIRE(top.full());
+    REQUIRE(top.threshold() == "b");
+    REQUIRE(!top.offer("a"));
+    REQUIRE(!top.offer("b"));
+    REQUIRE(top.offer("c"));
+    REQUIRE(top.threshold() == "c");
+    REQUIRE(top.sorted() == std::vector<std::string>{"d", "c"});
+
+    REQUIRE_THROWS_AS(algo::top_k<int>{0}, std::invalid_argument);
+}
+
+TEST_CASE("top_k takes empty batches", "[top_k]") {
+    algo::top_k<float> top{4};
+    top.offer_batch({});
+    REQUIRE(top.empty());
+    algo::top_k<float> const empty{4};
+    top.merge(empty);
+    REQUIRE(top.empty());
+
+    std::vector<float> const values{3, 1, 4, 1, 5, 9};
+    top.offer_batch(values);
+    top.offer_batch({});
+    top.merge(empty);
+    REQUIRE(top.sorted() == std::vector<float>{9, 5, 4, 3});
+}
+
+TEST_CASE("top_k merges per-thread accumulators", "[top_k]") {
+    auto const values = random_values<float>(50000, 9);
+    std::vector<algo::top_k<float>> partial(4, algo::top_k<float>{100});
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        partial[i % partial.size()].offer(values[i]);
+    }
+    algo::top_k<float> merged{100};
+    for (auto const& accumulator : partial) {
+        merged.merge(accumulator);
+    }
+    REQUIRE(merged.sorted() == expected_top(values, 100, std::less<>{}));
+
+    auto const before = merged.sorted();
+    merged.merge(merged);
+    REQUIRE(merged.sorted() == before);
+}